@@ -0,0 +1,414 @@
+// A small bytecode language for effects, so new ones can be uploaded as
+// data instead of compiled in. NeoPixel.jun runs them through the effect
+// Function. A program runs once per pixel on a stack of 32-bit values and
+// leaves the pixel's new color on top for END.
+//
+// load() checks a program once: every instruction is complete, jumps only
+// go forward and land on an instruction, and the stack depth at every
+// instruction is fixed and in bounds. It then translates the bytes into
+// fixed-width instructions with the jumps resolved, so the interpreter
+// runs with no checks at all, dispatching through a table of labels where
+// the compiler has them. Since jumps only go forward, every program ends.
+//
+// On a line with a matrix layout (Matrix.h) a program runs over the
+// matrix row by row, and X and Y give the pixel's place in it. On any
+// other line the pixels are one row.
+//
+// Programs are loaded into a fixed set of slots. Load them from the
+// thread that calls NeoPixel::update, never while a line is rendering.
+
+#ifndef KINDLING_EFFECTS_H
+#define KINDLING_EFFECTS_H
+
+#include <stdint.h>
+
+#include "Matrix.h"
+
+namespace Effects {
+    enum Op : uint8_t {
+        END,    // pop the pixel's new color and stop
+        PUSH8,  // push the next byte
+        PUSH32, // push the next four bytes, most significant first
+        INDEX,  // push the pixel's index along the line, or y * WIDTH + x
+        COUNT,  // push the number of pixels on the line, or in the matrix
+        TIME,   // push the time in milliseconds
+        PIXEL,  // push the pixel's current color
+        DUP,
+        DROP,
+        SWAP,
+        ADD,
+        SUB,
+        MUL,
+        DIV,    // division and remainder by zero give zero
+        MOD,
+        AND,
+        OR,
+        XOR,
+        SHL,    // shifts use the low five bits of the amount
+        SHR,
+        MIN,
+        MAX,
+        LT,     // 1 if the second value is below the top one, else 0
+        EQ,
+        SCALE8, // second * top / 256, the way FastLED scales channels
+        RGB,    // pop blue, green and red and push the packed color
+        JUMP,   // skip forward the number of bytes in the next byte
+        JUMPZ,  // pop, and jump like JUMP if the value was zero
+        X,      // push the pixel's column
+        Y,      // push the pixel's row
+        WIDTH,  // push the number of columns
+        HEIGHT, // push the number of rows
+        opCount
+    };
+
+    const uint32_t slots = 8;
+    const uint32_t maxInstructions = 64;
+    const uint32_t maxDepth = 8;
+
+    struct Instruction {
+        uint8_t op;
+        // The value PUSH8 and PUSH32 push, or the instruction a jump goes to
+        uint32_t arg;
+    };
+
+    struct Program {
+        Instruction code[maxInstructions];
+        uint32_t length;
+    };
+
+    // Programs that were never loaded have length 0 and leave pixels alone.
+    inline Program* programs() {
+        static Program table[slots];
+        return table;
+    }
+
+    // Pops and pushes of each op, in Op order.
+    const uint8_t pops[opCount] = { 1, 0, 0, 0, 0, 0, 0, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 0, 1, 0, 0, 0, 0 };
+    const uint8_t pushes[opCount] = { 0, 1, 1, 1, 1, 1, 1, 2, 0, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1 };
+
+    // Checks code and loads it into slot. Returns false, leaving the slot
+    // as it was, if the program is malformed or too big.
+    inline bool load(uint32_t slot, const uint8_t* code, uint32_t length) {
+        if (slot >= slots || length == 0 || length > 255) {
+            return false;
+        }
+
+        // Byte offset to instruction number, with jump targets recorded
+        // by byte until every instruction has a number.
+        int16_t numbers[256];
+        Instruction translated[maxInstructions];
+        uint8_t targets[maxInstructions];
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < 256; i++) {
+            numbers[i] = -1;
+        }
+
+        uint32_t at = 0;
+        while (at < length) {
+            uint8_t op = code[at];
+            if (op >= opCount || count == maxInstructions) {
+                return false;
+            }
+            numbers[at] = count;
+            Instruction& instruction = translated[count];
+            instruction.op = op;
+            instruction.arg = 0;
+            at++;
+            if (op == PUSH8 || op == JUMP || op == JUMPZ) {
+                if (at + 1 > length) {
+                    return false;
+                }
+                if (op == PUSH8) {
+                    instruction.op = PUSH32;
+                    instruction.arg = code[at];
+                } else {
+                    uint32_t target = at + 1 + code[at];
+                    if (target >= length) {
+                        return false;
+                    }
+                    targets[count] = target;
+                }
+                at++;
+            } else if (op == PUSH32) {
+                if (at + 4 > length) {
+                    return false;
+                }
+                instruction.arg = ((uint32_t) code[at] << 24) | ((uint32_t) code[at + 1] << 16) | ((uint32_t) code[at + 2] << 8) | code[at + 3];
+                at += 4;
+            }
+            count++;
+        }
+        if (translated[count - 1].op != END) {
+            return false;
+        }
+
+        // Jumps only go forward, so one pass in order sees every way into
+        // an instruction before the instruction itself.
+        int16_t depths[maxInstructions];
+        for (uint32_t i = 0; i < count; i++) {
+            depths[i] = -1;
+        }
+        depths[0] = 0;
+        for (uint32_t i = 0; i < count; i++) {
+            Instruction& instruction = translated[i];
+            if (instruction.op == JUMP || instruction.op == JUMPZ) {
+                int16_t target = numbers[targets[i]];
+                if (target < 0) {
+                    return false;
+                }
+                instruction.arg = target;
+            }
+            if (depths[i] < 0) {
+                // Nothing reaches it
+                continue;
+            }
+            int16_t depth = depths[i] - pops[instruction.op];
+            if (depth < 0 || depth + pushes[instruction.op] > (int16_t) maxDepth) {
+                return false;
+            }
+            depth += pushes[instruction.op];
+            uint32_t next[2];
+            uint32_t nNext = 0;
+            if (instruction.op != END && instruction.op != JUMP) {
+                next[nNext++] = i + 1;
+            }
+            if (instruction.op == JUMP || instruction.op == JUMPZ) {
+                next[nNext++] = instruction.arg;
+            }
+            for (uint32_t j = 0; j < nNext; j++) {
+                if (depths[next[j]] < 0) {
+                    depths[next[j]] = depth;
+                } else if (depths[next[j]] != depth) {
+                    return false;
+                }
+            }
+        }
+
+        Program& program = programs()[slot];
+        for (uint32_t i = 0; i < count; i++) {
+            program.code[i] = translated[i];
+        }
+        program.length = count;
+        return true;
+    }
+
+    // What a program sees that is the same for every pixel of a run
+    struct Context {
+        uint32_t count;
+        uint32_t width;
+        uint32_t height;
+        uint32_t time;
+    };
+
+    // Runs a checked program for one pixel and returns its new color.
+    inline uint32_t evaluate(const Instruction* code, const Context& context, uint32_t index, uint32_t x, uint32_t y, uint32_t pixel) {
+        uint32_t stack[maxDepth];
+        uint32_t* sp = stack;
+        const Instruction* ip = code;
+        uint32_t a;
+
+#if defined(__GNUC__)
+        static const void* const labels[opCount] = {
+            &&op_END, &&op_PUSH8, &&op_PUSH32, &&op_INDEX, &&op_COUNT, &&op_TIME, &&op_PIXEL,
+            &&op_DUP, &&op_DROP, &&op_SWAP, &&op_ADD, &&op_SUB, &&op_MUL, &&op_DIV, &&op_MOD,
+            &&op_AND, &&op_OR, &&op_XOR, &&op_SHL, &&op_SHR, &&op_MIN, &&op_MAX, &&op_LT,
+            &&op_EQ, &&op_SCALE8, &&op_RGB, &&op_JUMP, &&op_JUMPZ, &&op_X, &&op_Y, &&op_WIDTH,
+            &&op_HEIGHT
+        };
+#define EFFECTS_OP(name) op_##name:
+#define EFFECTS_NEXT() goto *labels[ip->op]
+        EFFECTS_NEXT();
+#else
+#define EFFECTS_OP(name) case name:
+#define EFFECTS_NEXT() continue
+        for (;;) switch (ip->op) {
+#endif
+        EFFECTS_OP(END)
+            return sp[-1];
+        EFFECTS_OP(PUSH8)
+        EFFECTS_OP(PUSH32)
+            *sp++ = ip->arg;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(INDEX)
+            *sp++ = index;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(COUNT)
+            *sp++ = context.count;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(TIME)
+            *sp++ = context.time;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(PIXEL)
+            *sp++ = pixel;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(DUP)
+            sp[0] = sp[-1];
+            sp++;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(DROP)
+            sp--;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(SWAP)
+            a = sp[-1];
+            sp[-1] = sp[-2];
+            sp[-2] = a;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(ADD)
+            sp--;
+            sp[-1] += sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(SUB)
+            sp--;
+            sp[-1] -= sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(MUL)
+            sp--;
+            sp[-1] *= sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(DIV)
+            sp--;
+            sp[-1] = sp[0] == 0 ? 0 : sp[-1] / sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(MOD)
+            sp--;
+            sp[-1] = sp[0] == 0 ? 0 : sp[-1] % sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(AND)
+            sp--;
+            sp[-1] &= sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(OR)
+            sp--;
+            sp[-1] |= sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(XOR)
+            sp--;
+            sp[-1] ^= sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(SHL)
+            sp--;
+            sp[-1] <<= sp[0] & 31;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(SHR)
+            sp--;
+            sp[-1] >>= sp[0] & 31;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(MIN)
+            sp--;
+            sp[-1] = sp[0] < sp[-1] ? sp[0] : sp[-1];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(MAX)
+            sp--;
+            sp[-1] = sp[0] > sp[-1] ? sp[0] : sp[-1];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(LT)
+            sp--;
+            sp[-1] = sp[-1] < sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(EQ)
+            sp--;
+            sp[-1] = sp[-1] == sp[0];
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(SCALE8)
+            sp--;
+            sp[-1] = (sp[-1] * sp[0]) >> 8;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(RGB)
+            sp -= 2;
+            sp[-1] = ((sp[-1] & 0xFF) << 16) | ((sp[0] & 0xFF) << 8) | (sp[1] & 0xFF);
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(JUMP)
+            ip = code + ip->arg;
+            EFFECTS_NEXT();
+        EFFECTS_OP(JUMPZ)
+            sp--;
+            ip = sp[0] == 0 ? code + ip->arg : ip + 1;
+            EFFECTS_NEXT();
+        EFFECTS_OP(X)
+            *sp++ = x;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(Y)
+            *sp++ = y;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(WIDTH)
+            *sp++ = context.width;
+            ip++;
+            EFFECTS_NEXT();
+        EFFECTS_OP(HEIGHT)
+            *sp++ = context.height;
+            ip++;
+            EFFECTS_NEXT();
+#if !defined(__GNUC__)
+        default:
+            return pixel;
+        }
+#endif
+#undef EFFECTS_OP
+#undef EFFECTS_NEXT
+    }
+
+    // Runs the program in slot over count pixels kept as a ring starting
+    // at offset, handing it each pixel's index in line order, or its place
+    // in layout if there is one. The results go back where they came from,
+    // so offset still applies. On palette lines PIXEL pushes the palette
+    // index and the result is cut to one.
+    template<typename Pixel>
+    void run(uint32_t slot, Pixel* pixels, uint32_t count, uint32_t offset, uint32_t time, const Matrix::Layout* layout = nullptr) {
+        if (slot >= slots || programs()[slot].length == 0) {
+            return;
+        }
+        const Instruction* code = programs()[slot].code;
+        uint32_t split = count - offset;
+        if (layout != nullptr) {
+            // The table gives each (x, y) its index along the line, which
+            // the ring turns into a place in pixels.
+            Context context = { (uint32_t) layout->width * layout->height, layout->width, layout->height, time };
+            const uint16_t* index = layout->index;
+            for (uint32_t y = 0; y < context.height; y++) {
+                for (uint32_t x = 0; x < context.width; x++) {
+                    uint32_t i = *index++;
+                    Pixel* pixel = i < split ? pixels + offset + i : pixels + (i - split);
+                    *pixel = (Pixel) evaluate(code, context, y * context.width + x, x, y, *pixel);
+                }
+            }
+            return;
+        }
+        Context context = { count, count, 1, time };
+        for (uint32_t i = 0; i < split; i++) {
+            Pixel* pixel = pixels + offset + i;
+            *pixel = (Pixel) evaluate(code, context, i, i, 0, *pixel);
+        }
+        for (uint32_t i = split; i < count; i++) {
+            Pixel* pixel = pixels + (i - split);
+            *pixel = (Pixel) evaluate(code, context, i, i, 0, *pixel);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,178 @@
+// Frames a line has already sent, kept so that a line that only rotates
+// between paints, as repeat(line, rotate(k)) does, plays them back instead
+// of diffing and encoding its pixels again. Rotating a ring whose pixels
+// repeat every p shows at most p different frames, keyed by offset % p, so
+// alternate needs two and set one.
+//
+// Every line's frames come out of one budget for the whole model, charged
+// as a line's store grows, so many long lines can't take more between them
+// than a small board has. A line whose frames don't fit, or whose store
+// can't be allocated, diffs as it would without them.
+//
+// Each line has its own Cache, touched only while that line renders, so
+// lines still render in parallel; only the budget is shared, and on the
+// ESP32 and the host, where lines render on workers, it is atomic.
+
+#ifndef KINDLING_FRAMES_H
+#define KINDLING_FRAMES_H
+
+#include <new>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+#include <atomic>
+#endif
+
+#include "Kernels.h"
+
+namespace Frames {
+    // Bytes of frames, and a flag for each, all lines together can keep.
+    // A line only allocates as much as its period needs, and grows it when
+    // a later one needs more.
+    const uint32_t budget = 16384;
+    const uint32_t none = 0xFFFFFFFF;
+
+    struct Cache {
+        // period flags saying which frames are filled in, then the frames,
+        // as the GRB bytes the strip was sent
+        uint8_t* store;
+        // Bytes allocated at store
+        uint32_t capacity;
+        // Set by a rotate and cleared by anything that repaints the ring,
+        // changes its levels or changes the palette
+        bool rotating;
+        // How often the ring repeats, 0 until worked out since the last
+        // paint, and whether that many frames fit
+        uint32_t period;
+        bool fits;
+        // The frame the strip's buffer holds, or none
+        uint32_t shown;
+
+        Cache() : store(nullptr), capacity(0), rotating(false), period(0), fits(false), shown(none) {}
+    };
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+    inline std::atomic<uint32_t>& charged() {
+        static std::atomic<uint32_t> bytes(0);
+        return bytes;
+    }
+
+    // Takes bytes from the budget, or returns false, taking nothing, if
+    // that would overspend it.
+    inline bool charge(uint32_t bytes) {
+        uint32_t now = charged().load(std::memory_order_relaxed);
+        do {
+            if (bytes > budget - now) {
+                return false;
+            }
+        } while (!charged().compare_exchange_weak(now, now + bytes, std::memory_order_relaxed));
+        return true;
+    }
+
+    inline void refund(uint32_t bytes) {
+        charged().fetch_sub(bytes, std::memory_order_relaxed);
+    }
+#else
+    // Only loop renders lines here, so nothing races for the budget.
+    inline uint32_t& charged() {
+        static uint32_t bytes = 0;
+        return bytes;
+    }
+
+    inline bool charge(uint32_t bytes) {
+        if (bytes > budget - charged()) {
+            return false;
+        }
+        charged() += bytes;
+        return true;
+    }
+
+    inline void refund(uint32_t bytes) {
+        charged() -= bytes;
+    }
+#endif
+
+    // Makes the line's store hold at least needed bytes, charging the
+    // budget for what it grows by. Returns false, leaving the store as it
+    // was, if the budget or the heap can't cover it.
+    inline bool reserve(Cache* cache, uint32_t needed) {
+        if (needed <= cache->capacity) {
+            return true;
+        }
+        uint32_t growth = needed - cache->capacity;
+        if (!charge(growth)) {
+            return false;
+        }
+        uint8_t* store = new (std::nothrow) uint8_t[needed];
+        if (store == nullptr) {
+            refund(growth);
+            return false;
+        }
+        delete[] cache->store;
+        cache->store = store;
+        cache->capacity = needed;
+        return true;
+    }
+
+    inline void rotated(Cache* cache) {
+        cache->rotating = true;
+    }
+
+    inline void invalidate(Cache* cache) {
+        cache->rotating = false;
+        cache->period = 0;
+        cache->shown = none;
+    }
+
+    // Puts the frame the ring makes at offset into the strip's buffer and
+    // previous, if the line has it. Returns -1 if it doesn't, which leaves
+    // both alone, and otherwise whether the strip's buffer changed.
+    template<typename Strip, typename Pixel>
+    int32_t replay(Cache* cache, Strip* strip, const Pixel* ring, Pixel* previous, uint32_t length, uint32_t offset) {
+        if (!cache->rotating || length == 0) {
+            return -1;
+        }
+        uint32_t frameBytes = length * 3;
+        if (cache->period == 0) {
+            cache->period = Kernels::ringPeriod(ring, length);
+            uint64_t needed = (uint64_t) cache->period * (frameBytes + 1);
+            cache->fits = needed <= budget && reserve(cache, (uint32_t) needed);
+            if (cache->fits) {
+                memset(cache->store, 0, cache->period);
+            }
+        }
+        if (!cache->fits) {
+            return -1;
+        }
+        uint32_t slot = offset % cache->period;
+        if (slot == cache->shown) {
+            return 0;
+        }
+        if (!cache->store[slot]) {
+            return -1;
+        }
+        memcpy(strip->getPixels(), cache->store + cache->period + slot * frameBytes, frameBytes);
+        uint32_t split = length - offset;
+        Kernels::copyPixels(previous, ring + offset, split);
+        Kernels::copyPixels(previous + split, ring, offset);
+        cache->shown = slot;
+        return 1;
+    }
+
+    // Keeps the frame the strip's buffer now holds as the one for offset,
+    // after replay had nothing for it.
+    template<typename Strip>
+    void record(Cache* cache, Strip* strip, uint32_t length, uint32_t offset) {
+        if (!cache->rotating || !cache->fits || length == 0) {
+            return;
+        }
+        uint32_t frameBytes = length * 3;
+        uint32_t slot = offset % cache->period;
+        memcpy(cache->store + cache->period + slot * frameBytes, strip->getPixels(), frameBytes);
+        cache->store[slot] = 1;
+        cache->shown = slot;
+    }
+}
+
+#endif
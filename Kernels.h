@@ -0,0 +1,386 @@
+// Low level pixel buffer routines used from NeoPixel.jun through inline C++.
+// They work on the raw arrays behind Juniper lists, so the pixel types
+// passed in must be plain values with no padding: 32-bit colors, or 8-bit
+// indices into the shared palette in Palette.h. Routines that paint take
+// colors either way, and on palette lines use their low byte as the index.
+
+#ifndef KINDLING_KERNELS_H
+#define KINDLING_KERNELS_H
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace Kernels {
+    template<typename Color>
+    inline Color word(const Color* pixel) {
+        static_assert(sizeof(Color) == 4 || sizeof(Color) == 1, "pixels must be packed 32-bit colors or 8-bit palette indices");
+        Color w;
+        memcpy(&w, pixel, sizeof(w));
+        return w;
+    }
+
+    // First index in [i, end) where a and b differ, or end. Compares 64
+    // bits of pixels at a time while the buffers match.
+    template<typename Color>
+    inline uint32_t skipEqual(const Color* a, const Color* b, uint32_t i, uint32_t end) {
+        const uint32_t stride = sizeof(uint64_t) / sizeof(Color);
+        for (; i + stride <= end; i += stride) {
+            uint64_t x;
+            uint64_t y;
+            memcpy(&x, a + i, sizeof(x));
+            memcpy(&y, b + i, sizeof(y));
+            if (x != y) {
+                break;
+            }
+        }
+        while (i < end && word(a + i) == word(b + i)) {
+            i++;
+        }
+        return i;
+    }
+
+    // First index in [i, end) where a and b are the same, or end.
+    template<typename Color>
+    inline uint32_t skipChanged(const Color* a, const Color* b, uint32_t i, uint32_t end) {
+        while (i < end && word(a + i) != word(b + i)) {
+            i++;
+        }
+        return i;
+    }
+
+    // Appends the runs of indices where previous and next differ to spans,
+    // numbering them from base. Returns the new number of spans.
+    template<typename Color, typename Span>
+    uint32_t diffRuns(const Color* previous, const Color* next, uint32_t length, uint32_t base, Span* spans, uint32_t count) {
+        uint32_t i = 0;
+        while (true) {
+            i = skipEqual(previous, next, i, length);
+            if (i == length) {
+                return count;
+            }
+            uint32_t j = skipChanged(previous, next, i, length);
+            spans[count].start = base + i;
+            spans[count].length = j - i;
+            count++;
+            i = j;
+        }
+    }
+
+    // Diffs strip positions [from, from + count) of the n pixel ring buffer
+    // pixels, read from offset, against previous, which is in strip order.
+    // Each span is split at the ring's wrap point, so it is contiguous in
+    // both buffers. spans needs room for count / 2 + 2 entries. Returns the
+    // number written.
+    template<typename Color, typename Span>
+    uint32_t diffSpans(const Color* previous, const Color* pixels, uint32_t n, uint32_t offset, uint32_t from, uint32_t count, Span* spans) {
+        uint32_t split = n - offset;
+        uint32_t end = from + count;
+        uint32_t written = 0;
+        if (from < split) {
+            uint32_t stop = end < split ? end : split;
+            written = diffRuns(previous + from, pixels + offset + from, stop - from, from, spans, written);
+        }
+        if (end > split) {
+            uint32_t begin = from > split ? from : split;
+            written = diffRuns(previous + begin, pixels + begin - split, end - begin, begin, spans, written);
+        }
+        return written;
+    }
+
+    // The smallest p dividing count for which the ring of count pixels is
+    // the same rotated by p, so rotating it by offset looks the same as by
+    // offset % p. Each candidate is one memcmp, which mostly fails early.
+    template<typename Color>
+    uint32_t ringPeriod(const Color* pixels, uint32_t count) {
+        for (uint32_t p = 1; p <= count / 2; p++) {
+            if (count % p == 0 && memcmp(pixels, pixels + p, (count - p) * sizeof(Color)) == 0) {
+                return p;
+            }
+        }
+        return count;
+    }
+
+    // Fills count pixels with first, second, first, second, ... Wide
+    // stores of the repeating pair do the bulk, using AVX2 or SSE2 where
+    // the compiler targets them and 64-bit words otherwise.
+    inline void fillPattern(uint32_t* pixels, uint32_t count, uint32_t first, uint32_t second) {
+        uint32_t i = 0;
+#if defined(__AVX2__)
+        __m256i wide = _mm256_setr_epi32(first, second, first, second, first, second, first, second);
+        for (; i + 8 <= count; i += 8) {
+            _mm256_storeu_si256((__m256i*) (pixels + i), wide);
+        }
+#elif defined(__SSE2__)
+        __m128i wide = _mm_setr_epi32(first, second, first, second);
+        for (; i + 4 <= count; i += 4) {
+            _mm_storeu_si128((__m128i*) (pixels + i), wide);
+        }
+#else
+        uint32_t pair[2] = { first, second };
+        uint64_t wide;
+        memcpy(&wide, pair, sizeof(wide));
+        for (; i + 2 <= count; i += 2) {
+            memcpy(pixels + i, &wide, sizeof(wide));
+        }
+#endif
+        for (; i < count; i++) {
+            pixels[i] = (i & 1) ? second : first;
+        }
+    }
+
+    inline void fillPattern(uint8_t* pixels, uint32_t count, uint32_t first, uint32_t second) {
+        uint8_t pair[8] = { (uint8_t) first, (uint8_t) second, (uint8_t) first, (uint8_t) second, (uint8_t) first, (uint8_t) second, (uint8_t) first, (uint8_t) second };
+        uint32_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            memcpy(pixels + i, pair, sizeof(pair));
+        }
+        for (; i < count; i++) {
+            pixels[i] = pair[i & 1];
+        }
+    }
+
+    template<typename Color>
+    inline void copyPixels(Color* to, const Color* from, uint32_t count) {
+        memcpy(to, from, count * sizeof(Color));
+    }
+
+    // Moves every channel of count pixels weight / 256 of the way to
+    // target's, rounding to nearest. c * (256 - weight) + t * weight + 128
+    // never needs more than 16 bits, so channels are blended in 16-bit
+    // lanes: eight or sixteen at a time with SSE2 or AVX2, and otherwise
+    // two to a 32-bit word, red with blue and green on its own.
+    inline void blendTowards(uint32_t* pixels, uint32_t count, uint32_t target, uint32_t weight) {
+        uint32_t keep = 256 - weight;
+        uint32_t i = 0;
+#if defined(__AVX2__)
+        __m256i zero = _mm256_setzero_si256();
+        __m256i keepWide = _mm256_set1_epi16(keep);
+        __m256i towardWide = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(_mm256_set1_epi32(target), zero), _mm256_set1_epi16(weight)), _mm256_set1_epi16(128));
+        for (; i + 8 <= count; i += 8) {
+            __m256i p = _mm256_loadu_si256((__m256i*) (pixels + i));
+            __m256i lo = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(p, zero), keepWide), towardWide), 8);
+            __m256i hi = _mm256_srli_epi16(_mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(p, zero), keepWide), towardWide), 8);
+            _mm256_storeu_si256((__m256i*) (pixels + i), _mm256_packus_epi16(lo, hi));
+        }
+#elif defined(__SSE2__)
+        __m128i zero = _mm_setzero_si128();
+        __m128i keepWide = _mm_set1_epi16(keep);
+        __m128i towardWide = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(_mm_set1_epi32(target), zero), _mm_set1_epi16(weight)), _mm_set1_epi16(128));
+        for (; i + 4 <= count; i += 4) {
+            __m128i p = _mm_loadu_si128((__m128i*) (pixels + i));
+            __m128i lo = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(p, zero), keepWide), towardWide), 8);
+            __m128i hi = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(p, zero), keepWide), towardWide), 8);
+            _mm_storeu_si128((__m128i*) (pixels + i), _mm_packus_epi16(lo, hi));
+        }
+#endif
+        uint32_t redBlue = (target & 0x00FF00FF) * weight + 0x00800080;
+        uint32_t green = ((target >> 8) & 0x00FF00FF) * weight + 0x00800080;
+        for (; i < count; i++) {
+            uint32_t c = pixels[i];
+            pixels[i] = ((((c & 0x00FF00FF) * keep + redBlue) >> 8) & 0x00FF00FF)
+                | ((((c >> 8) & 0x00FF00FF) * keep + green) & 0xFF00FF00);
+        }
+    }
+
+    // Palette indices blend as numbers, which fades along the palette
+    inline void blendTowards(uint8_t* pixels, uint32_t count, uint32_t target, uint32_t weight) {
+        uint32_t keep = 256 - weight;
+        uint32_t toward = (target & 0xFF) * weight + 128;
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = (pixels[i] * keep + toward) >> 8;
+        }
+    }
+
+    // HSV to a packed 0x00RRGGBB color in integer math, for boards with no
+    // FPU. hue goes once round the circle in 16 bits, so 65536 would be 360
+    // degrees, and saturation and value run to 255. Each channel is within
+    // 1 of what Color::hsvToRgb gives for the same color as floats.
+    inline uint32_t hsvToRgb(uint16_t hue, uint8_t saturation, uint8_t value) {
+        uint32_t scaled = (uint32_t) hue * 6;
+        uint32_t sector = scaled >> 16;
+        // How far the middle channel is from the low one to the high one,
+        // out of 65536. It climbs in even sectors and falls in odd ones.
+        uint32_t rise = scaled & 0xFFFF;
+        if (sector & 1) {
+            rise = 65536 - rise;
+        }
+        // value * (255 * 65536) still fits 32 bits, so the middle channel
+        // is one exact division
+        uint32_t high = value;
+        uint32_t low = high * (255 - saturation) / 255;
+        uint32_t middle = high * ((255 - saturation) * 65536 + saturation * rise) / 255 >> 16;
+        switch (sector) {
+            case 0: return (high << 16) | (middle << 8) | low;
+            case 1: return (middle << 16) | (high << 8) | low;
+            case 2: return (low << 16) | (high << 8) | middle;
+            case 3: return (low << 16) | (middle << 8) | high;
+            case 4: return (middle << 16) | (low << 8) | high;
+            default: return (high << 16) | (low << 8) | middle;
+        }
+    }
+
+    // Converts count colors packed as 0xHHHHSSVV, with hue, saturation and
+    // value as hsvToRgb takes them.
+    inline void hsvToRgb(uint32_t* out, const uint32_t* colors, uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            uint32_t c = colors[i];
+            out[i] = hsvToRgb(c >> 16, (c >> 8) & 0xFF, c & 0xFF);
+        }
+    }
+
+    // Fills table with the 256 colors of an 8-bit hue circle at one
+    // saturation and value.
+    inline void fillHueTable(uint32_t* table, uint8_t saturation, uint8_t value) {
+        for (uint32_t hue = 0; hue < 256; hue++) {
+            table[hue] = hsvToRgb(hue << 8, saturation, value);
+        }
+    }
+
+    // Converts count 8-bit hues sharing a saturation and value. Past 256
+    // of them it is cheaper to build the whole circle once and look each
+    // one up.
+    inline void huesToRgb(uint32_t* out, const uint8_t* hues, uint32_t count, uint8_t saturation, uint8_t value) {
+        if (count <= 256) {
+            for (uint32_t i = 0; i < count; i++) {
+                out[i] = hsvToRgb(hues[i] << 8, saturation, value);
+            }
+            return;
+        }
+        uint32_t table[256];
+        fillHueTable(table, saturation, value);
+        for (uint32_t i = 0; i < count; i++) {
+            out[i] = table[hues[i]];
+        }
+    }
+
+    // Fills count pixels on a straight line from first to last, each
+    // channel stepping in 16.16 fixed point and rounded to nearest.
+    inline void fillGradient(uint32_t* pixels, uint32_t count, uint32_t first, uint32_t last) {
+        if (count < 2) {
+            if (count == 1) {
+                pixels[0] = first;
+            }
+            return;
+        }
+        int32_t channels[3];
+        int32_t steps[3];
+        for (uint32_t c = 0; c < 3; c++) {
+            int32_t from = (first >> (16 - 8 * c)) & 0xFF;
+            int32_t to = (last >> (16 - 8 * c)) & 0xFF;
+            channels[c] = from * 65536 + 32768;
+            steps[c] = (to - from) * 65536 / (int32_t) (count - 1);
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = (uint32_t) (channels[0] >> 16) << 16 | (uint32_t) (channels[1] >> 16) << 8 | (uint32_t) (channels[2] >> 16);
+            channels[0] += steps[0];
+            channels[1] += steps[1];
+            channels[2] += steps[2];
+        }
+    }
+
+    inline void fillGradient(uint8_t* pixels, uint32_t count, uint32_t first, uint32_t last) {
+        if (count < 2) {
+            if (count == 1) {
+                pixels[0] = first;
+            }
+            return;
+        }
+        int32_t index = (int32_t) (first & 0xFF) * 65536 + 32768;
+        int32_t step = ((int32_t) (last & 0xFF) - (int32_t) (first & 0xFF)) * 65536 / (int32_t) (count - 1);
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = index >> 16;
+            index += step;
+        }
+    }
+
+    // Fills count pixels with one turn of the hue circle, starting at red,
+    // by writing their HSV words in place and converting them in one pass.
+    inline void fillRainbow(uint32_t* pixels, uint32_t count, uint8_t saturation, uint8_t value) {
+        uint32_t sv = (uint32_t) saturation << 8 | value;
+        // Lines have at most 65535 pixels, so i << 16 fits
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = (i << 16) / count << 16 | sv;
+        }
+        hsvToRgb(pixels, pixels, count);
+    }
+
+    // On a palette line the palette stands in for the hue circle, so the
+    // line goes once through its entries whatever the saturation and value
+    inline void fillRainbow(uint8_t* pixels, uint32_t count, uint8_t, uint8_t) {
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = (i << 8) / count;
+        }
+    }
+
+    // Fills the 256-entry table a line's channels are mapped through:
+    // brightness / 255 scaling (255 leaves values as they are), after a
+    // 2.6 gamma curve when gammaCorrect is set. 2.6 is the curve
+    // Adafruit_NeoPixel::gamma8 uses.
+    inline void fillLevels(uint8_t* levels, uint8_t brightness, bool gammaCorrect) {
+        for (uint32_t v = 0; v < 256; v++) {
+            uint32_t level = v;
+            if (gammaCorrect) {
+                level = (uint32_t) (powf(v / 255.0f, 2.6f) * 255.0f + 0.5f);
+            }
+            levels[v] = (uint8_t) ((level * (brightness + 1)) >> 8);
+        }
+    }
+
+    // Encodes packed 0x00RRGGBB colors as GRB bytes, mapping each channel
+    // through levels.
+    inline void encodeGRB(uint8_t* out, const uint32_t* colors, uint32_t count, const uint8_t* levels) {
+        for (uint32_t i = 0; i < count; i++, out += 3) {
+            uint32_t c = colors[i];
+            out[0] = levels[(c >> 8) & 0xFF];
+            out[1] = levels[(c >> 16) & 0xFF];
+            out[2] = levels[c & 0xFF];
+        }
+    }
+
+    // Writes count colors into a NEO_GRB strip's pixel buffer from pixel
+    // start on. levels takes the place of the strip's own brightness,
+    // which is left unset so the buffer holds exactly what is sent.
+    template<typename Strip>
+    void writeGRB(Strip* strip, uint32_t start, const uint32_t* colors, uint32_t count, const uint8_t* levels) {
+        encodeGRB(strip->getPixels() + start * 3, colors, count, levels);
+    }
+
+    // The same for either kind of line: colors go straight out and palette
+    // indices are looked up in palette on the way.
+    template<typename Strip>
+    void writeGRB(Strip* strip, uint32_t start, const uint32_t* colors, uint32_t count, const uint8_t* levels, const uint32_t*) {
+        writeGRB(strip, start, colors, count, levels);
+    }
+
+    template<typename Strip>
+    void writeGRB(Strip* strip, uint32_t start, const uint8_t* indices, uint32_t count, const uint8_t* levels, const uint32_t* palette) {
+        uint8_t* out = strip->getPixels() + start * 3;
+        for (uint32_t i = 0; i < count; i++, out += 3) {
+            uint32_t c = palette[indices[i]];
+            out[0] = levels[(c >> 8) & 0xFF];
+            out[1] = levels[(c >> 16) & 0xFF];
+            out[2] = levels[c & 0xFF];
+        }
+    }
+
+    // Reads back the colors a strip was left showing. Palette lines start
+    // on index 0 instead, since a color can't be turned back into one.
+    template<typename Strip>
+    void readPixels(Strip* strip, uint32_t* colors, uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            colors[i] = strip->getPixelColor(i);
+        }
+    }
+
+    template<typename Strip>
+    void readPixels(Strip*, uint8_t* indices, uint32_t count) {
+        memset(indices, 0, count);
+    }
+}
+
+#endif
@@ -0,0 +1,128 @@
+// Index tables for lines that are LED matrices. A layout maps each (x, y)
+// of a matrix to the pixel's place along the line, so effects can work in
+// 2D coordinates and look the wiring up instead of working it out. Tables
+// are built once, by load(), for matrices wired row by row, in a
+// serpentine, column by column, or made of tiles that are each wired one
+// of those ways and chained together in another.
+//
+// Layouts are loaded into a fixed set of slots, and a line uses one
+// through the matrix action in NeoPixel.jun. Load them from the thread
+// that calls NeoPixel::update, never while a line is rendering.
+
+#ifndef KINDLING_MATRIX_H
+#define KINDLING_MATRIX_H
+
+#include <stdint.h>
+
+namespace Matrix {
+    enum Order : uint8_t {
+        ROWS,              // every row left to right
+        SERPENTINE,        // rows alternately left to right and back
+        COLUMNS,           // every column top to bottom
+        COLUMN_SERPENTINE, // columns alternately top to bottom and back
+        orderCount
+    };
+
+    const uint32_t slots = 4;
+    // Table entries shared by every slot
+    const uint32_t poolSize = 1024;
+    // A line's matrix when it is a plain strip
+    const uint8_t none = 0xFF;
+
+    // index[y * width + x] is where (x, y) is along the line
+    struct Layout {
+        uint16_t width;
+        uint16_t height;
+        uint16_t* index;
+        uint32_t capacity;
+    };
+
+    // Layouts that were never loaded have no pixels, so nothing uses them.
+    inline Layout* layouts() {
+        static Layout table[slots];
+        return table;
+    }
+
+    inline uint16_t* pool() {
+        static uint16_t entries[poolSize];
+        return entries;
+    }
+
+    inline uint32_t& poolUsed() {
+        static uint32_t used = 0;
+        return used;
+    }
+
+    // The layout in slot, or nullptr if there is none or it covers more
+    // pixels than count, so the line can be treated as a plain strip.
+    inline const Layout* find(uint8_t slot, uint32_t count) {
+        if (slot >= slots) {
+            return nullptr;
+        }
+        const Layout& layout = layouts()[slot];
+        uint32_t size = (uint32_t) layout.width * layout.height;
+        if (size == 0 || size > count) {
+            return nullptr;
+        }
+        return &layout;
+    }
+
+    // Where (x, y) is among the width x height pixels wired in order.
+    inline uint32_t wired(uint32_t x, uint32_t y, uint32_t width, uint32_t height, Order order) {
+        switch (order) {
+            case SERPENTINE:
+                return y * width + ((y & 1) ? width - 1 - x : x);
+            case COLUMNS:
+                return x * height + y;
+            case COLUMN_SERPENTINE:
+                return x * height + ((x & 1) ? height - 1 - y : y);
+            default:
+                return y * width + x;
+        }
+    }
+
+    // Builds the table for a matrix of tilesAcross x tilesDown tiles, each
+    // tileWidth x tileHeight pixels wired in order, with the tiles chained
+    // in tileOrder. A single matrix is one tile. A slot keeps the table
+    // space it was first given and reuses it for anything no bigger.
+    // Returns false, leaving the slot as it was, if the arguments are out
+    // of range or the pool has no room.
+    inline bool load(uint32_t slot, uint16_t tileWidth, uint16_t tileHeight, uint8_t order, uint8_t tilesAcross, uint8_t tilesDown, uint8_t tileOrder) {
+        if (slot >= slots || order >= orderCount || tileOrder >= orderCount) {
+            return false;
+        }
+        uint32_t width = (uint32_t) tileWidth * tilesAcross;
+        uint32_t height = (uint32_t) tileHeight * tilesDown;
+        uint32_t size = width * height;
+        if (size == 0 || width > 0xFFFF || height > 0xFFFF || size > 0x10000) {
+            return false;
+        }
+
+        Layout& layout = layouts()[slot];
+        if (size > layout.capacity) {
+            if (size > poolSize - poolUsed()) {
+                return false;
+            }
+            layout.index = pool() + poolUsed();
+            layout.capacity = size;
+            poolUsed() += size;
+        }
+        layout.width = width;
+        layout.height = height;
+
+        uint32_t tileSize = (uint32_t) tileWidth * tileHeight;
+        for (uint32_t y = 0; y < height; y++) {
+            uint32_t tileY = y / tileHeight;
+            uint32_t inY = y - tileY * tileHeight;
+            for (uint32_t x = 0; x < width; x++) {
+                uint32_t tileX = x / tileWidth;
+                uint32_t inX = x - tileX * tileWidth;
+                uint32_t tile = wired(tileX, tileY, tilesAcross, tilesDown, (Order) tileOrder);
+                layout.index[y * width + x] = tile * tileSize + wired(inX, inY, tileWidth, tileHeight, (Order) order);
+            }
+        }
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,46 @@
+// The palette shared by every palette line, a line whose pixels are 8-bit
+// indices rather than colors (see Model in NeoPixel.jun). Indices are only
+// turned into colors on their way to the strip, so recoloring or cycling
+// the palette changes its 256 entries and never a line's pixels.
+//
+// Change it from the thread that calls NeoPixel::update, never while a
+// line is rendering.
+
+#ifndef KINDLING_PALETTE_H
+#define KINDLING_PALETTE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Kernels.h"
+
+namespace Palette {
+    const uint32_t size = 256;
+
+    // Starts out as the hue circle at full saturation and value, so a
+    // rainbow on a palette line looks the same as on any other.
+    inline uint32_t* colors() {
+        static uint32_t table[size];
+        static bool filled = (Kernels::fillHueTable(table, 255, 255), true);
+        (void) filled;
+        return table;
+    }
+
+    inline void set(uint8_t index, uint32_t color) {
+        colors()[index] = color;
+    }
+
+    // Moves every entry step places up the palette, wrapping round, so
+    // index i + step shows what index i did.
+    inline void rotate(int16_t step) {
+        uint32_t* table = colors();
+        uint32_t old[size];
+        memcpy(old, table, sizeof(old));
+        uint32_t shift = (uint32_t) step & (size - 1);
+        for (uint32_t i = 0; i < size; i++) {
+            table[(i + shift) & (size - 1)] = old[i];
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,107 @@
+// The fixed-size ring that actions reach NeoPixel::update through. It is
+// single producer, single consumer: one place pushes, which can be an ISR
+// or a task on the other core, while loop pops. Neither side locks. Each
+// index is only ever written by its own side, and the release store that
+// moves it on publishes the slot it covers.
+//
+// The ESP32 and the host build use std::atomic for the indices. Anywhere
+// else may have no C++ standard library, and the only other side is an
+// ISR on the same core, so they are volatile and loop holds interrupts off
+// while it touches one wider than the core can load or store at once.
+
+#ifndef KINDLING_QUEUE_H
+#define KINDLING_QUEUE_H
+
+#include <stdint.h>
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+#include <atomic>
+#endif
+
+namespace Queue {
+    template<typename T, uint32_t capacity>
+    class Ring {
+        static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0, "capacity must be a power of two");
+
+    public:
+        Ring() : head(0), tail(0) {}
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+        // Returns false, dropping item, when the ring is full.
+        bool push(T item) {
+            uint32_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) == capacity) {
+                return false;
+            }
+            items[t & (capacity - 1)] = item;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Returns false, leaving item alone, when the ring is empty.
+        bool pop(T& item) {
+            uint32_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = items[h & (capacity - 1)];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        T items[capacity];
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+#else
+        // Returns false, dropping item, when the ring is full. An ISR can't
+        // be interrupted by loop, and loop pushing never races itself
+        // popping, so only the slot has to be written before tail moves.
+        bool push(T item) {
+            uint32_t t = tail;
+            if (t - head == capacity) {
+                return false;
+            }
+            items[t & (capacity - 1)] = item;
+            __asm__ __volatile__("" ::: "memory");
+            tail = t + 1;
+            return true;
+        }
+
+        // Returns false, leaving item alone, when the ring is empty.
+        bool pop(T& item) {
+            uint32_t h = head;
+            noInterrupts();
+            uint32_t t = tail;
+            interrupts();
+            if (h == t) {
+                return false;
+            }
+            item = items[h & (capacity - 1)];
+            noInterrupts();
+            head = h + 1;
+            interrupts();
+            return true;
+        }
+
+    private:
+        T items[capacity];
+        volatile uint32_t head;
+        volatile uint32_t tail;
+#endif
+    };
+
+    const uint32_t actionCapacity = 32;
+
+    // A static member rather than a function-local static, so the ring is
+    // built during startup and an ISR never races its first use.
+    template<typename Action>
+    struct Actions {
+        static Ring<Action, actionCapacity> ring;
+    };
+
+    template<typename Action>
+    Ring<Action, actionCapacity> Actions<Action>::ring;
+}
+
+#endif
@@ -0,0 +1,240 @@
+// Records what a running sketch does to a compact binary log, so a session
+// from a real controller can be played back on the host (see
+// host/Replay.cpp). Every call to NeoPixel::update is logged, as an action
+// or, when it has none, a tick, along with the actions drainActions
+// stages without going through update. Optionally every frame
+// sent to a strip is logged too, so a replay can check it sends the same.
+//
+// Nothing is logged until start() is given a sink, which is handed each
+// record's bytes as it is made: a file on the host, or Serial or flash on a
+// controller. Record from the thread that calls NeoPixel::update.
+//
+// The log is a header, "KLOG" and a version byte, then records. Each
+// record is a tag byte and the microseconds since the last record as a
+// varint, then:
+//   TICK    nothing
+//   ACTION  an action, which update was called with
+//   STAGED  an action, which stageAction was called with
+//   FRAME   the strip's pin and pixel count as 16-bit little endian, then
+//           the GRB bytes it was sent
+// An action is its constructor's index in NeoPixel::Action then its
+// fields in order, and a Function likewise. uint8 and bool fields are a
+// byte, int16 two bytes little endian, colors four bytes little endian,
+// and intervals and durations varints. A maybe<uint8> is a 0 byte for
+// nothing, or a 1 byte and the value.
+
+#ifndef KINDLING_RECORDER_H
+#define KINDLING_RECORDER_H
+
+#include <stdint.h>
+
+namespace Recorder {
+    enum Tag : uint8_t {
+        TICK = 1,
+        ACTION,
+        STAGED,
+        FRAME
+    };
+
+    const uint8_t magic[4] = { 'K', 'L', 'O', 'G' };
+    const uint8_t version = 1;
+
+    typedef void (*Sink)(const uint8_t* bytes, uint32_t length, void* context);
+
+    struct State {
+        Sink sink;
+        void* context;
+        bool frames;
+        uint32_t last;
+    };
+
+    inline State& state() {
+        static State s = { nullptr, nullptr, false, 0 };
+        return s;
+    }
+
+    inline bool recording() {
+        return state().sink != nullptr;
+    }
+
+    // A record being put together, big enough for any action
+    struct Writer {
+        uint8_t bytes[40];
+        uint32_t length;
+
+        Writer() : length(0) {}
+
+        void u8(uint8_t v) {
+            bytes[length++] = v;
+        }
+
+        void u16(uint16_t v) {
+            u8(v & 0xFF);
+            u8(v >> 8);
+        }
+
+        void u32(uint32_t v) {
+            u16(v & 0xFFFF);
+            u16(v >> 16);
+        }
+
+        void varint(uint32_t v) {
+            while (v >= 0x80) {
+                u8((v & 0x7F) | 0x80);
+                v >>= 7;
+            }
+            u8(v);
+        }
+
+        void send() {
+            state().sink(bytes, length, state().context);
+        }
+    };
+
+    // Starts a log, writing its header. frames says whether to log every
+    // frame sent as well, which is much bigger than the actions.
+    inline void start(Sink sink, void* context, bool frames) {
+        State& s = state();
+        s.sink = sink;
+        s.context = context;
+        s.frames = frames;
+        s.last = micros();
+        Writer w;
+        for (uint32_t i = 0; i < sizeof(magic); i++) {
+            w.u8(magic[i]);
+        }
+        w.u8(version);
+        w.send();
+    }
+
+    inline void stop() {
+        state().sink = nullptr;
+    }
+
+    inline void begin(Writer& w, Tag tag) {
+        uint32_t now = micros();
+        w.u8(tag);
+        w.varint(now - state().last);
+        state().last = now;
+    }
+
+    template<typename Function>
+    void function(Writer& w, Function fn) {
+        w.u8(fn.id());
+        switch (fn.id()) {
+            case 0:
+                w.u16(fn.rotate());
+                break;
+            case 1:
+                w.u32(fn.set());
+                break;
+            case 2:
+                w.u32(fn.alternate().e1);
+                w.u32(fn.alternate().e2);
+                break;
+            case 3:
+                w.u8(fn.effect());
+                break;
+            case 4:
+                w.u32(fn.fade().e1);
+                w.varint(fn.fade().e2);
+                break;
+            case 5:
+                w.u32(fn.gradient().e1);
+                w.u32(fn.gradient().e2);
+                break;
+            case 6:
+                w.u8(fn.rainbow().e1);
+                w.u8(fn.rainbow().e2);
+                break;
+            case 7:
+                w.u8(fn.stream());
+                break;
+        }
+    }
+
+    template<typename Action>
+    void action(Tag tag, Action a) {
+        Writer w;
+        begin(w, tag);
+        w.u8(a.id());
+        switch (a.id()) {
+            case 1:
+                w.u8(a.run().e1);
+                function(w, a.run().e2);
+                break;
+            case 2:
+                w.u8(a.repeat().e1);
+                function(w, a.repeat().e2);
+                w.varint(a.repeat().e3);
+                if (a.repeat().e4.id() == 0) {
+                    w.u8(1);
+                    w.u8(a.repeat().e4.just());
+                } else {
+                    w.u8(0);
+                }
+                break;
+            case 3:
+                w.u8(a.endRepeat());
+                break;
+            case 4:
+                w.u8(a.brightness().e1);
+                w.u8(a.brightness().e2);
+                break;
+            case 5:
+                w.u8(a.gammaCorrect().e1);
+                w.u8(a.gammaCorrect().e2);
+                break;
+            case 6:
+                w.u8(a.paletteColor().e1);
+                w.u32(a.paletteColor().e2);
+                break;
+            case 7:
+                w.u16(a.rotatePalette());
+                break;
+            case 8:
+                w.u8(a.matrix().e1);
+                w.u8(a.matrix().e2);
+                break;
+        }
+        w.send();
+    }
+
+    // Logs a call to NeoPixel::update with act, a maybe<Action>
+    template<typename MaybeAction>
+    void update(MaybeAction act) {
+        if (!recording()) {
+            return;
+        }
+        if (act.id() == 0) {
+            action(ACTION, act.just());
+        } else {
+            Writer w;
+            begin(w, TICK);
+            w.send();
+        }
+    }
+
+    template<typename Action>
+    void staged(Action a) {
+        if (recording()) {
+            action(STAGED, a);
+        }
+    }
+
+    // Logs the frame strip has just been told to show
+    template<typename Strip>
+    void frame(Strip* strip) {
+        if (!recording() || !state().frames) {
+            return;
+        }
+        Writer w;
+        begin(w, FRAME);
+        w.u16(strip->getPin());
+        w.u16(strip->numPixels());
+        w.send();
+        state().sink(strip->getPixels(), (uint32_t) strip->numPixels() * 3, state().context);
+    }
+}
+
+#endif
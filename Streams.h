@@ -0,0 +1,178 @@
+// Raw frames for lines to play, such as pre-rendered video, read from a
+// file, a pipe or a serial port. A frame is every pixel of the line in
+// line order, three bytes each, red, green then blue, or on palette lines
+// one byte each, the palette index. On a line with a matrix layout the
+// frame's first width x height pixels are the matrix row by row, however
+// it is wired.
+//
+// Each slot reads through a Source, which copies up to length bytes that
+// are ready into bytes without waiting for more, and returns how many it
+// copied, or -1 once there will be no more. stream(slot) in NeoPixel.jun
+// reads one frame each time it is applied, chunkSize bytes at a time,
+// straight into the line's pixels, so repeating it at the frame rate lets
+// the scheduler pace playback. If the source runs dry partway through a
+// frame, the pixels that have arrived are shown and the next firing
+// carries on from where it stopped. A firing while the strip is still too
+// busy for the last frame reads nothing, so no frame is read over before
+// it is sent.
+//
+// A slot feeds one line at a time. Open and close them from the thread
+// that calls NeoPixel::update, never while a line is rendering.
+
+#ifndef KINDLING_STREAMS_H
+#define KINDLING_STREAMS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "Matrix.h"
+
+namespace Streams {
+    typedef int32_t (*Source)(uint8_t* bytes, uint32_t length, void* context);
+
+    // One for every line of the largest model
+    const uint32_t slots = 64;
+    // Bytes asked of a source at once, a whole number of pixels of either
+    // kind
+    const uint32_t chunkSize = 768;
+
+    struct Stream {
+        Source source;
+        void* context;
+        // Pixels of the frame being read that have arrived
+        uint32_t next;
+        // The start of a pixel that was split between two reads
+        uint8_t carry[3];
+        uint8_t carried;
+        uint32_t frames;
+    };
+
+    inline Stream* streams() {
+        static Stream table[slots];
+        return table;
+    }
+
+    // Starts slot reading from source, from the start of a frame. Returns
+    // false if there is no such slot.
+    inline bool open(uint32_t slot, Source source, void* context) {
+        if (slot >= slots) {
+            return false;
+        }
+        Stream& s = streams()[slot];
+        s.source = source;
+        s.context = context;
+        s.next = 0;
+        s.carried = 0;
+        s.frames = 0;
+        return true;
+    }
+
+    inline void close(uint32_t slot) {
+        if (slot < slots) {
+            streams()[slot].source = nullptr;
+        }
+    }
+
+    // Whether slot has no source, so stream(slot) leaves a line as it is
+    inline bool idle(uint32_t slot) {
+        return slot >= slots || streams()[slot].source == nullptr;
+    }
+
+    // Frames slot has read in full since it was opened
+    inline uint32_t frames(uint32_t slot) {
+        return slot < slots ? streams()[slot].frames : 0;
+    }
+
+    // A Source for an Arduino Stream, such as Serial or an SD card File,
+    // passed as the context. It never ends.
+    template<typename Port>
+    int32_t portSource(uint8_t* bytes, uint32_t length, void* context) {
+        Port* port = (Port*) context;
+        int available = port->available();
+        if (available <= 0) {
+            return 0;
+        }
+        return port->read(bytes, (uint32_t) available < length ? (uint32_t) available : length);
+    }
+
+    inline void unpack(uint32_t* pixels, const uint8_t* bytes, uint32_t count) {
+        for (uint32_t i = 0; i < count; i++) {
+            pixels[i] = (uint32_t) bytes[3 * i] << 16 | (uint32_t) bytes[3 * i + 1] << 8 | bytes[3 * i + 2];
+        }
+    }
+
+    inline void unpack(uint8_t* pixels, const uint8_t* bytes, uint32_t count) {
+        memcpy(pixels, bytes, count);
+    }
+
+    // Stores frame pixels from to from + count, which came in as bytes, in
+    // the ring of length pixels starting at offset, through layout if
+    // there is one.
+    template<typename Pixel>
+    void store(Pixel* pixels, uint32_t length, uint32_t offset, const Matrix::Layout* layout, uint32_t from, const uint8_t* bytes, uint32_t count) {
+        const uint32_t size = sizeof(Pixel) == 1 ? 1 : 3;
+        uint32_t split = length - offset;
+        uint32_t mapped = layout != nullptr ? (uint32_t) layout->width * layout->height : 0;
+        for (uint32_t i = from; i < from + count && i < mapped; i++) {
+            uint32_t at = layout->index[i];
+            unpack(at < split ? pixels + offset + at : pixels + (at - split), bytes, 1);
+            bytes += size;
+        }
+        uint32_t i = from > mapped ? from : mapped;
+        uint32_t end = from + count;
+        // Past any layout the frame is in ring order, which wraps at most
+        // once.
+        if (i < split && i < end) {
+            uint32_t run = (end < split ? end : split) - i;
+            unpack(pixels + offset + i, bytes, run);
+            bytes += run * size;
+            i += run;
+        }
+        if (i < end) {
+            unpack(pixels + (i - split), bytes, end - i);
+        }
+    }
+
+    // Reads what has arrived of the next frame into the ring of length
+    // pixels starting at offset, stopping at the end of the frame. Returns
+    // whether it finished one.
+    template<typename Pixel>
+    bool read(uint32_t slot, Pixel* pixels, uint32_t length, uint32_t offset, const Matrix::Layout* layout = nullptr) {
+        if (idle(slot) || length == 0) {
+            return false;
+        }
+        const uint32_t size = sizeof(Pixel) == 1 ? 1 : 3;
+        Stream& s = streams()[slot];
+        if (s.next >= length) {
+            // The line got shorter since the last firing.
+            s.next = 0;
+            s.carried = 0;
+        }
+        uint8_t chunk[chunkSize];
+        while (s.next < length) {
+            memcpy(chunk, s.carry, s.carried);
+            uint32_t want = (length - s.next) * size - s.carried;
+            if (want > chunkSize - s.carried) {
+                want = chunkSize - s.carried;
+            }
+            int32_t got = s.source(chunk + s.carried, want, s.context);
+            if (got <= 0) {
+                if (got < 0) {
+                    s.source = nullptr;
+                }
+                return false;
+            }
+            uint32_t bytes = s.carried + (uint32_t) got;
+            uint32_t count = bytes / size;
+            store(pixels, length, offset, layout, s.next, chunk, count);
+            s.next += count;
+            s.carried = bytes - count * size;
+            memcpy(s.carry, chunk + count * size, s.carried);
+        }
+        s.next = 0;
+        s.frames++;
+        return true;
+    }
+}
+
+#endif
@@ -0,0 +1,247 @@
+// A small fixed pool of threads that NeoPixel.jun spreads line rendering
+// over. Jobs are claimed from an atomic counter and each finished one is
+// handed back through its own atomic flag, so the calling thread can show
+// lines while the rest are still rendering, without taking a lock.
+//
+// On the ESP32 the pool is one task pinned to core 0, since the Arduino
+// loop runs on core 1. The host build uses std::threads, one fewer than
+// the machine has cores unless KINDLING_WORKERS says otherwise. Anywhere
+// else there are no workers and everything runs on the calling thread,
+// and nothing here needs std::atomic, which those targets may not have.
+
+#ifndef KINDLING_WORKERS_H
+#define KINDLING_WORKERS_H
+
+#include <stdint.h>
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+#include <atomic>
+#endif
+
+#if defined(ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(KINDLING_HOST)
+#include <stdlib.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
+namespace Workers {
+#if defined(ESP32) || defined(KINDLING_HOST)
+    // One call to forEach. Workers only touch it between being started on
+    // it and dropping out of Pool::busy.
+    struct Job {
+        void* context;
+        void (*run)(void* context, uint32_t i);
+        uint32_t count;
+        std::atomic<uint32_t> next;
+        std::atomic<uint8_t>* done;
+    };
+
+    // Claims and runs the job's items until there are none left.
+    inline void work(Job& job) {
+        uint32_t i;
+        while ((i = job.next.fetch_add(1, std::memory_order_relaxed)) < job.count) {
+            job.run(job.context, i);
+            job.done[i].store(1, std::memory_order_release);
+        }
+    }
+#endif
+
+#if defined(ESP32)
+    class Pool {
+    public:
+        Pool() : job(nullptr), busy(0) {
+            // Rendering works on the arena in place. The deepest render
+            // kindling-bench measures, streams on 64 lines, peaks at about
+            // 6.5KB of stack counting update's frames above it, and this
+            // leaves room over that for Serial and interrupts.
+            xTaskCreatePinnedToCore(&Pool::loop, "kindling", 12288, this, 1, &task, 0);
+        }
+
+        uint32_t size() const { return 1; }
+
+        void start(Job* next) {
+            job = next;
+            busy.store(1, std::memory_order_release);
+            xTaskNotifyGive(task);
+        }
+
+        void finish() {
+            while (busy.load(std::memory_order_acquire) != 0) {
+                pause();
+            }
+        }
+
+        static void pause() { taskYIELD(); }
+
+    private:
+        static void loop(void* self) {
+            Pool* pool = (Pool*) self;
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                work(*pool->job);
+                pool->busy.store(0, std::memory_order_release);
+            }
+        }
+
+        TaskHandle_t task;
+        Job* job;
+        std::atomic<uint32_t> busy;
+    };
+#elif defined(KINDLING_HOST)
+    class Pool {
+    public:
+        Pool() : job(nullptr), generation(0), busy(0), stopping(false) {
+            uint32_t n = std::thread::hardware_concurrency();
+            n = n > 1 ? n - 1 : 0;
+            if (const char* env = getenv("KINDLING_WORKERS")) {
+                n = atoi(env);
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                threads.emplace_back([this] { loop(); });
+            }
+        }
+
+        ~Pool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            wake.notify_all();
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+        }
+
+        uint32_t size() const { return threads.size(); }
+
+        // The mutex only puts idle workers to sleep and wakes them; claiming
+        // and handing back work goes through the job's atomics.
+        void start(Job* next) {
+            busy.store(threads.size(), std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = next;
+                generation++;
+            }
+            wake.notify_all();
+        }
+
+        void finish() {
+            while (busy.load(std::memory_order_acquire) != 0) {
+                pause();
+            }
+        }
+
+        static void pause() { std::this_thread::yield(); }
+
+    private:
+        void loop() {
+            uint64_t seen = 0;
+            for (;;) {
+                Job* current;
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    wake.wait(lock, [&] { return stopping || generation != seen; });
+                    if (stopping) {
+                        return;
+                    }
+                    seen = generation;
+                    current = job;
+                }
+                work(*current);
+                busy.fetch_sub(1, std::memory_order_release);
+            }
+        }
+
+        std::vector<std::thread> threads;
+        std::mutex mutex;
+        std::condition_variable wake;
+        Job* job;
+        uint64_t generation;
+        std::atomic<uint32_t> busy;
+        bool stopping;
+    };
+#else
+    class Pool {
+    public:
+        uint32_t size() const { return 0; }
+    };
+#endif
+
+    inline Pool& pool() {
+        static Pool instance;
+        return instance;
+    }
+
+    // Calls render(i) for every i below count, spread over the pool and
+    // the calling thread, and output(i, result) on the calling thread for
+    // each i in order as soon as render(i) has returned. render must only
+    // touch state belonging to i.
+    template<int count, typename Render, typename Output>
+    void forEach(Render& render, Output& output) {
+        Pool& workers = pool();
+        if (count < 2 || workers.size() == 0) {
+            for (uint32_t i = 0; i < count; i++) {
+                output(i, render(i));
+            }
+            return;
+        }
+
+#if defined(ESP32) || defined(KINDLING_HOST)
+        typedef decltype(render(0u)) Result;
+        struct Context {
+            Render& render;
+            Result* results;
+
+            static void run(void* self, uint32_t i) {
+                Context* context = (Context*) self;
+                context->results[i] = context->render(i);
+            }
+        };
+
+        Result results[count];
+        std::atomic<uint8_t> done[count];
+        for (uint32_t i = 0; i < count; i++) {
+            done[i].store(0, std::memory_order_relaxed);
+        }
+        Context context = { render, results };
+        Job job;
+        job.context = &context;
+        job.run = &Context::run;
+        job.count = count;
+        job.next.store(0, std::memory_order_relaxed);
+        job.done = done;
+        workers.start(&job);
+
+        // Render alongside the workers, showing whatever is ready in order
+        // between items, then wait out the stragglers.
+        uint32_t shown = 0;
+        uint32_t i;
+        while ((i = job.next.fetch_add(1, std::memory_order_relaxed)) < count) {
+            Context::run(&context, i);
+            done[i].store(1, std::memory_order_release);
+            while (shown < count && done[shown].load(std::memory_order_acquire)) {
+                output(shown, results[shown]);
+                shown++;
+            }
+        }
+        while (shown < count) {
+            if (done[shown].load(std::memory_order_acquire)) {
+                output(shown, results[shown]);
+                shown++;
+            } else {
+                Pool::pause();
+            }
+        }
+        workers.finish();
+#endif
+    }
+}
+
+#endif
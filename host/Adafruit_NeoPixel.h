@@ -0,0 +1,184 @@
+// Virtual Adafruit_NeoPixel for the host build. It keeps the same
+// interface and the same GRB byte buffer (including the library's lossy
+// brightness scaling) as the real driver, but instead of clocking bits
+// out of a pin it records what was written: setPixelColor and direct
+// writes through getPixels() land in the same pixel buffer, and every
+// show() snapshots that buffer as the transmitted frame.
+
+#ifndef KINDLING_HOST_ADAFRUIT_NEOPIXEL_H
+#define KINDLING_HOST_ADAFRUIT_NEOPIXEL_H
+
+#include "Arduino.h"
+
+#include <vector>
+
+typedef uint16_t neoPixelType;
+
+#define NEO_RGB ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_RBG ((0 << 6) | (0 << 4) | (2 << 2) | (1))
+#define NEO_GRB ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_GBR ((2 << 6) | (2 << 4) | (0 << 2) | (1))
+#define NEO_BRG ((1 << 6) | (1 << 4) | (2 << 2) | (0))
+#define NEO_BGR ((2 << 6) | (2 << 4) | (1 << 2) | (0))
+
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+class Adafruit_NeoPixel {
+public:
+    // WS2812 timing: 24 bits at 1.25us each, then a 300us latch.
+    static const uint32_t usPerPixel = 30;
+    static const uint32_t latchUs = 300;
+
+    Adafruit_NeoPixel(uint16_t n, int16_t p = 6, neoPixelType t = NEO_GRB + NEO_KHZ800)
+        : pin(p), brightness(0), endTime(0), begun(false), shows(0), writes(0), changes(0) {
+        rOffset = (t >> 4) & 0b11;
+        gOffset = (t >> 2) & 0b11;
+        bOffset = t & 0b11;
+        updateLength(n);
+        instances().push_back(this);
+    }
+
+    ~Adafruit_NeoPixel() {
+        std::vector<Adafruit_NeoPixel*>& all = instances();
+        for (size_t i = 0; i < all.size(); i++) {
+            if (all[i] == this) {
+                all.erase(all.begin() + i);
+                break;
+            }
+        }
+    }
+
+    // Every strip constructed so far, in construction order, so a host
+    // driver can inspect what the render path produced.
+    static std::vector<Adafruit_NeoPixel*>& instances() {
+        static std::vector<Adafruit_NeoPixel*> all;
+        return all;
+    }
+
+    void begin() { begun = true; }
+
+    void show() {
+        for (size_t i = 0; i < pixels.size(); i += 3) {
+            if (memcmp(&pixels[i], &frame[i], 3) != 0) {
+                changes++;
+            }
+        }
+        frame = pixels;
+        shows++;
+        endTime = micros() + numLEDs * usPerPixel;
+    }
+
+    bool canShow() { return micros() >= endTime + latchUs; }
+
+    void setPin(int16_t p) { pin = p; }
+
+    void updateLength(uint16_t n) {
+        numLEDs = n;
+        pixels.assign(n * 3, 0);
+        frame.assign(n * 3, 0);
+    }
+
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+        if (n >= numLEDs) {
+            return;
+        }
+        if (brightness) {
+            r = (r * brightness) >> 8;
+            g = (g * brightness) >> 8;
+            b = (b * brightness) >> 8;
+        }
+        uint8_t* p = &pixels[n * 3];
+        p[rOffset] = r;
+        p[gOffset] = g;
+        p[bOffset] = b;
+        writes++;
+    }
+
+    void setPixelColor(uint16_t n, uint32_t c) {
+        setPixelColor(n, (uint8_t) (c >> 16), (uint8_t) (c >> 8), (uint8_t) c);
+    }
+
+    uint32_t getPixelColor(uint16_t n) {
+        if (n >= numLEDs) {
+            return 0;
+        }
+        uint8_t* p = &pixels[n * 3];
+        uint32_t r = p[rOffset];
+        uint32_t g = p[gOffset];
+        uint32_t b = p[bOffset];
+        if (brightness) {
+            r = (r << 8) / brightness;
+            g = (g << 8) / brightness;
+            b = (b << 8) / brightness;
+        }
+        return (r << 16) | (g << 8) | b;
+    }
+
+    void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0) {
+        uint16_t end = count == 0 || first + count > numLEDs ? numLEDs : first + count;
+        for (uint16_t i = first; i < end; i++) {
+            setPixelColor(i, c);
+        }
+    }
+
+    // Like the real library, this rescales the existing buffer in place
+    // and loses precision every time it's called.
+    void setBrightness(uint8_t b) {
+        uint8_t newBrightness = b + 1;
+        if (newBrightness == brightness) {
+            return;
+        }
+        uint8_t oldBrightness = brightness - 1;
+        uint16_t scale;
+        if (oldBrightness == 0) {
+            scale = 0;
+        } else if (b == 255) {
+            scale = 65535 / oldBrightness;
+        } else {
+            scale = (((uint16_t) newBrightness << 8) - 1) / oldBrightness;
+        }
+        for (size_t i = 0; i < pixels.size(); i++) {
+            pixels[i] = (pixels[i] * scale) >> 8;
+        }
+        brightness = newBrightness;
+    }
+
+    uint8_t getBrightness() const { return brightness - 1; }
+
+    void clear() { memset(pixels.data(), 0, pixels.size()); }
+
+    uint8_t* getPixels() { return pixels.data(); }
+    uint16_t numPixels() const { return numLEDs; }
+    int16_t getPin() const { return pin; }
+
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t) r << 16) | ((uint32_t) g << 8) | b;
+    }
+
+    // Recording, not part of the Adafruit interface.
+    const std::vector<uint8_t>& shownFrame() const { return frame; }
+    uint32_t showCount() const { return shows; }
+    uint32_t writeCount() const { return writes; }
+    // Pixels that differed from the previous frame, summed over every
+    // show(), however they were written.
+    uint32_t changeCount() const { return changes; }
+    bool isBegun() const { return begun; }
+
+private:
+    uint16_t numLEDs;
+    int16_t pin;
+    uint8_t brightness;
+    uint8_t rOffset;
+    uint8_t gOffset;
+    uint8_t bOffset;
+    std::vector<uint8_t> pixels;
+    std::vector<uint8_t> frame;
+    unsigned long endTime;
+    bool begun;
+    uint32_t shows;
+    uint32_t writes;
+    uint32_t changes;
+};
+
+#endif
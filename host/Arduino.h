@@ -0,0 +1,146 @@
+// Host stand-in for the Arduino core, just enough of it for main.cpp to
+// build and run on Linux. Time is virtual: millis()/micros() only move
+// when delay() (or Host::advance) is called, so runs are deterministic
+// and never actually sleep.
+
+#ifndef KINDLING_HOST_ARDUINO_H
+#define KINDLING_HOST_ARDUINO_H
+
+// Lets headers shared with the device build pick their host versions
+#define KINDLING_HOST
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+
+#define BIN 2
+#define OCT 8
+#define DEC 10
+#define HEX 16
+
+namespace Host {
+    inline uint64_t& clock() {
+        static uint64_t us = 0;
+        return us;
+    }
+
+    inline void advance(uint64_t us) {
+        clock() += us;
+    }
+
+    // Serial output goes to stdout unless muted, which the benchmarks do
+    // so the debug printing in the render path doesn't dominate timings.
+    inline bool& quiet() {
+        static bool q = false;
+        return q;
+    }
+}
+
+inline unsigned long micros() {
+    return (unsigned long) Host::clock();
+}
+
+inline unsigned long millis() {
+    return (unsigned long) (Host::clock() / 1000);
+}
+
+inline void delay(unsigned long ms) {
+    Host::advance((uint64_t) ms * 1000);
+}
+
+inline void delayMicroseconds(unsigned int us) {
+    Host::advance(us);
+}
+
+inline void randomSeed(unsigned long seed) {
+    srand((unsigned int) seed);
+}
+
+inline long random(long howBig) {
+    return howBig == 0 ? 0 : rand() % howBig;
+}
+
+inline long random(long howSmall, long howBig) {
+    return howSmall >= howBig ? howSmall : howSmall + random(howBig - howSmall);
+}
+
+inline void pinMode(uint8_t pin, uint8_t mode) {}
+inline void digitalWrite(uint8_t pin, uint8_t val) {}
+inline int digitalRead(uint8_t pin) { return LOW; }
+inline int analogRead(uint8_t pin) { return 0; }
+inline void analogWrite(uint8_t pin, int val) {}
+
+class HostSerial {
+public:
+    void begin(unsigned long baud) {}
+
+    explicit operator bool() { return true; }
+
+    void print(const char* str) { write("%s", str); }
+    void print(char c) { write("%c", c); }
+    void print(int n, int base = DEC) { printNumber((long) n, base); }
+    void print(long n, int base = DEC) { printNumber(n, base); }
+    void print(unsigned int n, int base = DEC) { printNumber((unsigned long) n, base); }
+    void print(unsigned long n, int base = DEC) { printNumber(n, base); }
+    void print(unsigned char n, int base = DEC) { printNumber((unsigned long) n, base); }
+    void print(double f, int places = 2) { write("%.*f", places, f); }
+
+    template<typename T>
+    void println(T value) {
+        print(value);
+        println();
+    }
+
+    template<typename T>
+    void println(T value, int format) {
+        print(value, format);
+        println();
+    }
+
+    void println() { write("\n"); }
+
+private:
+    template<typename... Args>
+    void write(const char* format, Args... args) {
+        if (!Host::quiet()) {
+            printf(format, args...);
+        }
+    }
+
+    void printNumber(long n, int base) {
+        if (n < 0 && base == DEC) {
+            write("-");
+            n = -n;
+        }
+        printNumber((unsigned long) n, base);
+    }
+
+    void printNumber(unsigned long n, int base) {
+        char buf[8 * sizeof(long) + 1];
+        char* str = &buf[sizeof(buf) - 1];
+        *str = '\0';
+        if (base < 2) {
+            base = DEC;
+        }
+        do {
+            unsigned long digit = n % base;
+            n /= base;
+            *--str = digit < 10 ? '0' + digit : 'A' + digit - 10;
+        } while (n);
+        write("%s", str);
+    }
+};
+
+inline HostSerial Serial;
+
+#endif
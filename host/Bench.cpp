@@ -0,0 +1,457 @@
+// Frame-rendering benchmarks for NeoPixel::update on the host build.
+//
+// Every case builds a Model of nLines x nPixels and drives it through
+// update() the way a controller would, either with a run() action per
+// line per frame, or with one repeat() per line followed by timer ticks.
+// After those, the effect interpreter and a few pixel kernels are timed on
+// their own. The stream cases play frames from a file on a loop, a
+// stream slot per line.
+// Each case runs on its own thread with a painted stack so the deepest
+// stack use of the frames can be read back afterwards, and global
+// operator new is counted to get heap traffic per frame.
+//
+//   kindling-bench [-t ms] [-f filter]
+
+#include "../main.cpp"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <new>
+#include <string>
+
+namespace Bench {
+    struct Allocations {
+        uint64_t count;
+        uint64_t bytes;
+    };
+
+    Allocations allocations = { 0, 0 };
+
+    struct Result {
+        uint64_t frames;
+        double seconds;
+        Allocations allocations;
+        size_t stack;
+    };
+
+    const size_t stackSize = 16 * 1024 * 1024;
+    const uint8_t stackPaint = 0xA5;
+
+    // 60fps, the rate the run() cases send frames at and the repeat() cases
+    // tick their operations at.
+    const uint32_t frameInterval = 16;
+
+    // The virtual milliseconds between frames: frameInterval, or as long
+    // as a strip of length pixels takes to send a frame and latch if that
+    // is longer, so no frame is held back for a busy strip and the figures
+    // are for rendering every one.
+    inline uint32_t frameTime(uint32_t length) {
+        uint32_t sending = (length * Adafruit_NeoPixel::usPerPixel + Adafruit_NeoPixel::latchUs + 999) / 1000;
+        return sending > frameInterval ? sending : frameInterval;
+    }
+
+    double budget = 0.25;
+    const char* filter = nullptr;
+
+    // The lowest address of the running case's stack, which grows down
+    // towards it
+    uint8_t* stackBase = nullptr;
+
+    // Paints the unused part of this thread's stack, as pthreads reports
+    // it, leaving some room below the caller's frame. Addresses are worked
+    // out as integers since they span objects.
+    __attribute__((noinline)) void paintStack() {
+        pthread_attr_t attr;
+        void* base;
+        size_t size;
+        pthread_getattr_np(pthread_self(), &attr);
+        pthread_attr_getstack(&attr, &base, &size);
+        pthread_attr_destroy(&attr);
+        stackBase = (uint8_t*) base;
+        uintptr_t here = (uintptr_t) __builtin_frame_address(0);
+        memset(stackBase, stackPaint, here - 512 - (uintptr_t) stackBase);
+    }
+
+    // Bytes of stack used below top since paintStack
+    size_t usedStack(uint8_t* top) {
+        uint8_t* p = stackBase;
+        size_t unused = (uintptr_t) top - (uintptr_t) stackBase;
+        size_t i = 0;
+        while (i < unused && p[i] == stackPaint) {
+            i++;
+        }
+        return unused - i;
+    }
+
+    enum Mode { runMode, repeatMode };
+
+    // The two functions a frame flips between in run mode, so every frame
+    // changes every pixel. Repeat mode only uses the first. Cases that
+    // read streams have one opened for each line.
+    struct Case {
+        const char* name;
+        NeoPixel::Function (*function)(bool flip, uint8_t line);
+        bool streams;
+    };
+
+    NeoPixel::color red() { return NeoPixel::RGB(255, 0, 0); }
+    NeoPixel::color blue() { return NeoPixel::RGB(0, 0, 255); }
+
+    using namespace Effects;
+
+    struct Effect {
+        const char* name;
+        std::vector<uint8_t> code;
+    };
+
+    // Loaded into slots 0 to 3 in this order.
+    const Effect programs[] = {
+        // The smallest program there is, to show the cost of a dispatch
+        { "constant", { PUSH32, 0x00, 0x20, 0x40, 0x60, END } },
+        // A red to green gradient along the line, scrolling with time
+        { "gradient", {
+            INDEX, PUSH32, 0, 0, 1, 0, MUL, COUNT, DIV,
+            TIME, PUSH8, 3, SHR, ADD, PUSH8, 255, AND,
+            DUP, PUSH8, 255, SWAP, SUB, PUSH8, 64, RGB, END } },
+        // Every eighth pixel lit white, moving with time, and the rest
+        // fading to half what they were
+        { "chase", {
+            INDEX, TIME, PUSH8, 4, SHR, ADD, PUSH8, 8, MOD, JUMPZ, 11,
+            PIXEL, PUSH8, 1, SHR, PUSH32, 0x00, 0x7F, 0x7F, 0x7F, AND, END,
+            PUSH32, 0x00, 0xFF, 0xFF, 0xFF, END } },
+        // 4x4 checks of white and blue, swapping with time, in 2D on a
+        // matrix and as 4 pixel bands along a strip
+        { "checker", {
+            X, PUSH8, 2, SHR, Y, PUSH8, 2, SHR, XOR,
+            TIME, PUSH8, 8, SHR, ADD, PUSH8, 1, AND, JUMPZ, 6,
+            PUSH32, 0x00, 0xFF, 0xFF, 0xFF, END,
+            PUSH32, 0x00, 0x00, 0x00, 0xFF, END } },
+    };
+
+    // The layout interpret/checker-matrix runs checker through, a 32x32
+    // serpentine matrix, the same 1024 pixels runKernel times everything on
+    const uint8_t matrixSlot = 0;
+
+    const Case cases[] = {
+        { "rotate", [](bool flip, uint8_t) { return NeoPixel::rotate(flip ? -1 : 1); } },
+        { "set", [](bool flip, uint8_t) { return NeoPixel::set(flip ? blue() : red()); } },
+        { "alternate", [](bool flip, uint8_t) { return flip ? NeoPixel::alternate(blue(), red()) : NeoPixel::alternate(red(), blue()); } },
+        // The clock moves on every frame, so both change every pixel
+        { "effect", [](bool flip, uint8_t) { return NeoPixel::effect(flip ? 2 : 1); } },
+        // A new target would restart the fade, so both flips carry on the
+        // same one, which is slow enough to blend on every frame
+        { "fade", [](bool, uint8_t) { return NeoPixel::fade(red(), 4000); } },
+        // Repeat mode reapplies the same one, which the line has cached
+        { "gradient", [](bool flip, uint8_t) { return flip ? NeoPixel::gradient(blue(), red()) : NeoPixel::gradient(red(), blue()); } },
+        { "rainbow", [](bool flip, uint8_t) { return NeoPixel::rainbow(255, flip ? 128 : 255); } },
+        // Every frame is a new one from the file
+        { "stream", [](bool, uint8_t line) { return NeoPixel::stream(line); }, true },
+    };
+
+    // Frames in the file the stream cases play
+    const uint32_t streamFrames = 8;
+
+    // Reads the file open on the descriptor in context, going back to the
+    // start at the end, so the frames play on a loop.
+    int32_t fileSource(uint8_t* bytes, uint32_t length, void* context) {
+        int fd = (int) (intptr_t) context;
+        ssize_t got = read(fd, bytes, length);
+        if (got == 0) {
+            lseek(fd, 0, SEEK_SET);
+            got = read(fd, bytes, length);
+        }
+        return got < 0 ? 0 : (int32_t) got;
+    }
+
+    // Writes streamFrames frames of noise for nPixels pixel lines to a
+    // file and opens a stream on it for each line. Returns false if the
+    // file can't be made.
+    template<typename Pixel>
+    bool openStreams(int nLines, int nPixels) {
+        char path[] = "/tmp/kindling-bench-XXXXXX";
+        int fd = mkstemp(path);
+        if (fd < 0) {
+            return false;
+        }
+        std::vector<uint8_t> bytes((size_t) streamFrames * nPixels * (sizeof(Pixel) == 1 ? 1 : 3));
+        uint32_t seed = 1;
+        for (size_t i = 0; i < bytes.size(); i++) {
+            seed = seed * 1664525u + 1013904223u;
+            bytes[i] = seed >> 24;
+        }
+        bool written = write(fd, bytes.data(), bytes.size()) == (ssize_t) bytes.size();
+        close(fd);
+        for (int line = 0; written && line < nLines; line++) {
+            int lineFd = open(path, O_RDONLY);
+            written = lineFd >= 0 && Streams::open(line, fileSource, (void*) (intptr_t) lineFd);
+        }
+        unlink(path);
+        return written;
+    }
+
+    void closeStreams(int nLines) {
+        for (int line = 0; line < nLines; line++) {
+            if (!Streams::idle(line)) {
+                close((int) (intptr_t) Streams::streams()[line].context);
+                Streams::close(line);
+            }
+        }
+    }
+
+    template<typename Pixel, int nLines, int nPixels>
+    struct Fixture {
+        const Case& function;
+        Mode mode;
+        Result result;
+
+        static void* start(void* self) {
+            ((Fixture*) self)->run();
+            return nullptr;
+        }
+
+        template<typename Model>
+        void send(NeoPixel::Action action, Model& model) {
+            NeoPixel::update<Pixel, nLines, nLines * nPixels>(Prelude::just<NeoPixel::Action>(action), model);
+        }
+
+        template<typename Model>
+        void tick(Model& model) {
+            delay(frameTime(nPixels));
+            NeoPixel::update<Pixel, nLines, nLines * nPixels>(Prelude::nothing<NeoPixel::Action>(), model);
+        }
+
+        void run() {
+            juniper::array<NeoPixel::DeviceDescriptor, nLines> descriptors;
+            for (int i = 0; i < nLines; i++) {
+                descriptors[i].pin = i;
+                descriptors[i].length = nPixels;
+            }
+            // Each case stands for a board that has just booted, so the
+            // lines earlier cases left behind don't hold any of the frame
+            // budget.
+            Frames::charged().store(0);
+            auto model = NeoPixel::initialState<Pixel, nLines * nPixels, nLines>(descriptors);
+
+            send(NeoPixel::start(), model);
+            // Give rotate something to move.
+            for (int line = 0; line < nLines; line++) {
+                send(NeoPixel::run(line, NeoPixel::alternate(red(), blue())), model);
+            }
+            if (mode == repeatMode) {
+                for (int line = 0; line < nLines; line++) {
+                    send(NeoPixel::repeat(line, function.function(false, line), frameTime(nPixels), Prelude::nothing<uint8_t>()), model);
+                }
+            }
+
+            uint8_t top;
+            paintStack();
+            Allocations before = allocations;
+            auto begin = std::chrono::steady_clock::now();
+            std::chrono::duration<double> elapsed(0);
+            uint64_t frames = 0;
+
+            while (elapsed.count() < budget || frames < 10) {
+                if (mode == runMode) {
+                    // Lines only take a new frame once their strip is done
+                    // sending the last one.
+                    delay(frameTime(nPixels));
+                    for (int line = 0; line < nLines; line++) {
+                        send(NeoPixel::run(line, function.function(frames & 1, line)), model);
+                    }
+                } else {
+                    tick(model);
+                }
+                frames++;
+                elapsed = std::chrono::steady_clock::now() - begin;
+            }
+
+            result.frames = frames;
+            result.seconds = elapsed.count();
+            result.allocations.count = allocations.count - before.count;
+            result.allocations.bytes = allocations.bytes - before.bytes;
+            result.stack = usedStack(&top);
+
+            if (mode == repeatMode) {
+                for (int line = 0; line < nLines; line++) {
+                    send(NeoPixel::endRepeat(line), model);
+                }
+            }
+        }
+    };
+
+    // Palette lines, with uint8_t pixels, are named NxMp
+    template<typename Pixel, int nLines, int nPixels>
+    void runCase(const Case& function, Mode mode) {
+        const char* modeName = mode == runMode ? "run" : "repeat";
+        const char* storage = sizeof(Pixel) == 1 ? "p" : "";
+        std::string name = std::to_string(nLines) + "x" + std::to_string(nPixels) + storage + "/" + modeName + "/" + function.name;
+        if (filter != nullptr && name.find(filter) == std::string::npos) {
+            return;
+        }
+
+        if (function.streams && !openStreams<Pixel>(nLines, nPixels)) {
+            fprintf(stderr, "%s: couldn't make a file to stream\n", name.c_str());
+            closeStreams(nLines);
+            return;
+        }
+
+        Fixture<Pixel, nLines, nPixels> fixture = { function, mode, {} };
+
+        pthread_attr_t attr;
+        pthread_attr_init(&attr);
+        pthread_attr_setstacksize(&attr, stackSize);
+        pthread_t thread;
+        pthread_create(&thread, &attr, &Fixture<Pixel, nLines, nPixels>::start, &fixture);
+        pthread_join(thread, nullptr);
+        pthread_attr_destroy(&attr);
+        if (function.streams) {
+            closeStreams(nLines);
+        }
+
+        Result& r = fixture.result;
+        double frameSeconds = r.seconds / r.frames;
+        printf("%-28s %12.1f %10.2f %12.1f %12.0f %10zu\n",
+            name.c_str(),
+            1.0 / frameSeconds,
+            frameSeconds * 1e9 / (nLines * nPixels),
+            (double) r.allocations.count / r.frames,
+            (double) r.allocations.bytes / r.frames,
+            r.stack);
+        fflush(stdout);
+    }
+
+    // Times step(pixels, count, frame) alone over a 1024 pixel buffer.
+    template<typename Step>
+    void runKernel(const std::string& name, Step step) {
+        if (filter != nullptr && name.find(filter) == std::string::npos) {
+            return;
+        }
+
+        const uint32_t count = 1024;
+        std::vector<uint32_t> pixels(count, 0);
+        auto begin = std::chrono::steady_clock::now();
+        std::chrono::duration<double> elapsed(0);
+        uint64_t frames = 0;
+        while (elapsed.count() < budget || frames < 10) {
+            step(pixels.data(), count, frames);
+            frames++;
+            elapsed = std::chrono::steady_clock::now() - begin;
+        }
+
+        double frameSeconds = elapsed.count() / frames;
+        printf("%-28s %12.1f %10.2f\n", name.c_str(), 1.0 / frameSeconds, frameSeconds * 1e9 / count);
+        fflush(stdout);
+    }
+
+    template<typename Pixel, int nLines, int nPixels>
+    void runModel() {
+        for (const Case& function : cases) {
+            runCase<Pixel, nLines, nPixels>(function, runMode);
+            runCase<Pixel, nLines, nPixels>(function, repeatMode);
+        }
+    }
+}
+
+void* operator new(size_t size) {
+    Bench::allocations.count++;
+    Bench::allocations.bytes += size;
+    void* p = malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+// Kept out of line so the compiler never sees free() called on memory from
+// a new expression, which it would warn about.
+__attribute__((noinline)) void operator delete(void* p) noexcept {
+    free(p);
+}
+
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+    free(p);
+}
+
+int main(int argc, char** argv) {
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            Bench::budget = atof(argv[++i]) / 1000.0;
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            Bench::filter = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-t ms] [-f filter]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    Host::quiet() = true;
+
+    for (uint32_t slot = 0; slot < sizeof(Bench::programs) / sizeof(Bench::programs[0]); slot++) {
+        const std::vector<uint8_t>& code = Bench::programs[slot].code;
+        if (!Effects::load(slot, code.data(), code.size())) {
+            fprintf(stderr, "program %s failed to load\n", Bench::programs[slot].name);
+            return 1;
+        }
+    }
+
+    printf("%-28s %12s %10s %12s %12s %10s\n",
+        "case", "frames/s", "ns/pixel", "allocs/frame", "bytes/frame", "stack");
+    Bench::runModel<uint32_t, 1, 150>();
+    Bench::runModel<uint32_t, 4, 300>();
+    Bench::runModel<uint32_t, 8, 600>();
+    Bench::runModel<uint32_t, 16, 1024>();
+    Bench::runModel<uint32_t, 64, 1024>();
+    Bench::runModel<uint8_t, 16, 1024>();
+    Bench::runModel<uint8_t, 64, 1024>();
+
+    for (uint32_t slot = 0; slot < sizeof(Bench::programs) / sizeof(Bench::programs[0]); slot++) {
+        Bench::runKernel(std::string("interpret/") + Bench::programs[slot].name, [slot](uint32_t* pixels, uint32_t count, uint64_t frame) {
+            Effects::run(slot, pixels, count, 0, frame * Bench::frameInterval);
+        });
+    }
+    if (!Matrix::load(Bench::matrixSlot, 32, 32, Matrix::SERPENTINE, 1, 1, Matrix::ROWS)) {
+        fprintf(stderr, "matrix layout failed to load\n");
+        return 1;
+    }
+    Bench::runKernel("interpret/checker-matrix", [](uint32_t* pixels, uint32_t count, uint64_t frame) {
+        Effects::run(3, pixels, count, 0, frame * Bench::frameInterval, Matrix::find(Bench::matrixSlot, count));
+    });
+
+    // What a fade step costs next to copying the buffer
+    std::vector<uint32_t> source(1024, Bench::blue());
+    Bench::runKernel("kernel/copy", [&source](uint32_t* pixels, uint32_t count, uint64_t) {
+        Kernels::copyPixels(pixels, source.data(), count);
+    });
+    Bench::runKernel("kernel/blend", [](uint32_t* pixels, uint32_t count, uint64_t frame) {
+        Kernels::blendTowards(pixels, count, (frame & 1) ? Bench::blue() : Bench::red(), 64);
+    });
+
+    // Integer HSV against the float Color::hsvToRgb it stands in for
+    std::vector<uint32_t> hsv(1024);
+    std::vector<uint8_t> hues(1024);
+    for (uint32_t i = 0; i < 1024; i++) {
+        hsv[i] = (i * 64) << 16 | 0xFFFF;
+        hues[i] = i;
+    }
+    Bench::runKernel("kernel/hsv-float", [](uint32_t* pixels, uint32_t count, uint64_t) {
+        for (uint32_t i = 0; i < count; i++) {
+            juniper::records::recordt_5<float, float, float> color;
+            color.h = i * (360.0f / count);
+            color.s = 1.0f;
+            color.v = 1.0f;
+            juniper::records::recordt_3<uint8_t, uint8_t, uint8_t> rgb = Color::hsvToRgb(color);
+            pixels[i] = NeoPixel::RGB(rgb.r, rgb.g, rgb.b);
+        }
+    });
+    Bench::runKernel("kernel/hsv", [&hsv](uint32_t* pixels, uint32_t count, uint64_t) {
+        Kernels::hsvToRgb(pixels, hsv.data(), count);
+    });
+    Bench::runKernel("kernel/hues", [&hues](uint32_t* pixels, uint32_t count, uint64_t) {
+        Kernels::huesToRgb(pixels, hues.data(), count, 255, 255);
+    });
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Runs the sketch in main.cpp on the host against the virtual strips in
+// Adafruit_NeoPixel.h, then reports what each strip was sent. With -r it
+// records the session to a log for kindling-replay, with every frame sent
+// as well if -F is given.
+//
+//   kindling [-n loops] [-q] [-r log [-F]]
+
+#include "Arduino.h"
+#include "Adafruit_NeoPixel.h"
+#include "../Recorder.h"
+
+void setup();
+void loop();
+
+namespace NeoPixel {
+    extern uint32_t suppressedShows;
+}
+
+static uint32_t checksum(const std::vector<uint8_t>& bytes) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < bytes.size(); i++) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static void writeLog(const uint8_t* bytes, uint32_t length, void* file) {
+    fwrite(bytes, 1, length, (FILE*) file);
+}
+
+int main(int argc, char** argv) {
+    long loops = 100;
+    const char* logPath = nullptr;
+    bool logFrames = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            loops = atol(argv[++i]);
+        } else if (strcmp(argv[i], "-q") == 0) {
+            Host::quiet() = true;
+        } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+            logPath = argv[++i];
+        } else if (strcmp(argv[i], "-F") == 0) {
+            logFrames = true;
+        } else {
+            fprintf(stderr, "usage: %s [-n loops] [-q] [-r log [-F]]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    FILE* log = nullptr;
+    if (logPath != nullptr) {
+        log = fopen(logPath, "wb");
+        if (log == nullptr) {
+            perror(logPath);
+            return 1;
+        }
+        Recorder::start(writeLog, log, logFrames);
+    }
+
+    setup();
+    for (long i = 0; i < loops; i++) {
+        loop();
+    }
+
+    if (log != nullptr) {
+        Recorder::stop();
+        fclose(log);
+    }
+
+    std::vector<Adafruit_NeoPixel*>& strips = Adafruit_NeoPixel::instances();
+    fprintf(stderr, "%ld loops, %.3fs virtual time, %u unchanged frames not shown\n",
+        loops, Host::clock() / 1e6, NeoPixel::suppressedShows);
+    for (size_t i = 0; i < strips.size(); i++) {
+        Adafruit_NeoPixel* strip = strips[i];
+        fprintf(stderr, "strip %zu: pin %d, %u pixels, %u shows, %u pixel changes, frame %08x\n",
+            i, strip->getPin(), strip->numPixels(), strip->showCount(),
+            strip->changeCount(), checksum(strip->shownFrame()));
+    }
+
+    return 0;
+}
@@ -0,0 +1,349 @@
+// Plays a log made by Recorder.h back through NeoPixel::update on the host
+// build, as fast as it will go, on the model the sketch in main.cpp
+// declares. The virtual clock is set to each record's time before it is
+// played, so operations tick and strips free up just as they did when it
+// was recorded. If the log has frames, the first pass checks every strip
+// was sent the same ones.
+//
+//   kindling-replay log [-n passes]
+
+#include "../main.cpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <map>
+
+namespace Replay {
+    // The element type and length of a juniper::array
+    template<typename Array>
+    struct Shape;
+
+    template<typename T, size_t N>
+    struct Shape<juniper::array<T, N>> {
+        using Element = T;
+        static const int length = (int) N;
+    };
+
+    // The shape of TEA::state, which update and stageAction need spelled
+    // out, read off its type so it follows whatever TEA.jun declares.
+    using Lines = decltype(TEA::state.get()->lines.data);
+    using Pixels = decltype(TEA::state.get()->lines.data[0].get()->arena.get()->pixels.data);
+    using Pixel = Shape<Pixels>::Element;
+    const int nLines = Shape<Lines>::length;
+    const int nPixels = Shape<Pixels>::length;
+
+    struct Reader {
+        const uint8_t* at;
+        const uint8_t* end;
+        bool failed;
+
+        bool more() const {
+            return !failed && at < end;
+        }
+
+        uint8_t u8() {
+            if (at >= end) {
+                failed = true;
+                return 0;
+            }
+            return *at++;
+        }
+
+        uint16_t u16() {
+            uint16_t low = u8();
+            return low | (uint16_t) u8() << 8;
+        }
+
+        uint32_t u32() {
+            uint32_t low = u16();
+            return low | (uint32_t) u16() << 16;
+        }
+
+        uint32_t varint() {
+            uint32_t v = 0;
+            for (uint32_t shift = 0; shift < 35; shift += 7) {
+                uint8_t b = u8();
+                v |= (uint32_t) (b & 0x7F) << shift;
+                if (!(b & 0x80)) {
+                    return v;
+                }
+            }
+            failed = true;
+            return v;
+        }
+
+        const uint8_t* bytes(uint32_t length) {
+            if ((uint32_t) (end - at) < length) {
+                failed = true;
+                return nullptr;
+            }
+            const uint8_t* p = at;
+            at += length;
+            return p;
+        }
+    };
+
+    NeoPixel::Function function(Reader& r) {
+        switch (r.u8()) {
+            case 0:
+                return NeoPixel::rotate((int16_t) r.u16());
+            case 1:
+                return NeoPixel::set(r.u32());
+            case 2: {
+                uint32_t a = r.u32();
+                return NeoPixel::alternate(a, r.u32());
+            }
+            case 3:
+                return NeoPixel::effect(r.u8());
+            case 4: {
+                uint32_t target = r.u32();
+                return NeoPixel::fade(target, r.varint());
+            }
+            case 5: {
+                uint32_t a = r.u32();
+                return NeoPixel::gradient(a, r.u32());
+            }
+            case 6: {
+                uint8_t a = r.u8();
+                return NeoPixel::rainbow(a, r.u8());
+            }
+            case 7:
+                return NeoPixel::stream(r.u8());
+        }
+        r.failed = true;
+        return NeoPixel::rotate(0);
+    }
+
+    NeoPixel::Action action(Reader& r) {
+        switch (r.u8()) {
+            case 0:
+                return NeoPixel::start();
+            case 1: {
+                uint8_t line = r.u8();
+                return NeoPixel::run(line, function(r));
+            }
+            case 2: {
+                uint8_t line = r.u8();
+                NeoPixel::Function fn = function(r);
+                uint32_t interval = r.varint();
+                Prelude::maybe<uint8_t> endAfter = Prelude::nothing<uint8_t>();
+                if (r.u8()) {
+                    endAfter = Prelude::just<uint8_t>(r.u8());
+                }
+                return NeoPixel::repeat(line, fn, interval, endAfter);
+            }
+            case 3:
+                return NeoPixel::endRepeat(r.u8());
+            case 4: {
+                uint8_t line = r.u8();
+                return NeoPixel::brightness(line, r.u8());
+            }
+            case 5: {
+                uint8_t line = r.u8();
+                return NeoPixel::gammaCorrect(line, r.u8() != 0);
+            }
+            case 6: {
+                uint8_t index = r.u8();
+                return NeoPixel::paletteColor(index, r.u32());
+            }
+            case 7:
+                return NeoPixel::rotatePalette((int16_t) r.u16());
+            case 8: {
+                uint8_t line = r.u8();
+                return NeoPixel::matrix(line, r.u8());
+            }
+        }
+        r.failed = true;
+        return NeoPixel::start();
+    }
+
+    struct Counts {
+        uint64_t records;
+        uint64_t actions;
+        uint64_t staged;
+        uint64_t ticks;
+        uint64_t frames;
+        uint64_t mismatches;
+    };
+
+    Adafruit_NeoPixel* strip(uint16_t pin) {
+        std::vector<Adafruit_NeoPixel*>& strips = Adafruit_NeoPixel::instances();
+        for (size_t i = 0; i < strips.size(); i++) {
+            if (strips[i]->getPin() == pin) {
+                return strips[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Frames shown so far on every strip
+    uint32_t shows() {
+        uint32_t total = 0;
+        for (Adafruit_NeoPixel* s : Adafruit_NeoPixel::instances()) {
+            total += s->showCount();
+        }
+        return total;
+    }
+
+    // The last frame logged for each pin since the last update, which is
+    // what its strip should be showing now.
+    struct Expected {
+        const uint8_t* bytes;
+        uint16_t count;
+    };
+
+    void check(std::map<uint16_t, Expected>& expected, Counts& counts) {
+        for (auto& entry : expected) {
+            Adafruit_NeoPixel* s = strip(entry.first);
+            const Expected& frame = entry.second;
+            if (s == nullptr || s->numPixels() != frame.count
+                    || s->shownFrame().size() != (size_t) frame.count * 3
+                    || memcmp(s->shownFrame().data(), frame.bytes, (size_t) frame.count * 3) != 0) {
+                counts.mismatches++;
+            }
+        }
+        expected.clear();
+    }
+
+    // Plays every record after the header once, starting the clock at
+    // base. Returns false if the log is cut short or malformed.
+    bool play(Reader r, uint64_t base, bool checkFrames, Counts& counts) {
+        auto& model = TEA::state;
+        std::map<uint16_t, Expected> expected;
+        uint64_t time = base;
+        while (r.more()) {
+            uint8_t tag = r.u8();
+            time += r.varint();
+            Host::clock() = time;
+            counts.records++;
+            if (tag != Recorder::FRAME && checkFrames) {
+                check(expected, counts);
+            }
+            switch (tag) {
+                case Recorder::TICK:
+                    counts.ticks++;
+                    NeoPixel::update<Pixel, nLines, nPixels>(Prelude::nothing<NeoPixel::Action>(), model);
+                    break;
+                case Recorder::ACTION: {
+                    NeoPixel::Action a = action(r);
+                    if (r.failed) {
+                        return false;
+                    }
+                    counts.actions++;
+                    NeoPixel::update<Pixel, nLines, nPixels>(Prelude::just<NeoPixel::Action>(a), model);
+                    break;
+                }
+                case Recorder::STAGED: {
+                    NeoPixel::Action a = action(r);
+                    if (r.failed) {
+                        return false;
+                    }
+                    counts.staged++;
+                    NeoPixel::stageAction<Pixel, nLines, nPixels>(a, model);
+                    break;
+                }
+                case Recorder::FRAME: {
+                    uint16_t pin = r.u16();
+                    uint16_t count = r.u16();
+                    const uint8_t* bytes = r.bytes((uint32_t) count * 3);
+                    if (r.failed) {
+                        return false;
+                    }
+                    counts.frames++;
+                    expected[pin] = { bytes, count };
+                    break;
+                }
+                default:
+                    return false;
+            }
+        }
+        if (checkFrames) {
+            check(expected, counts);
+        }
+        Host::clock() = time;
+        return !r.failed;
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* path = nullptr;
+    long passes = 1;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+            passes = atol(argv[++i]);
+        } else if (path == nullptr && argv[i][0] != '-') {
+            path = argv[i];
+        } else {
+            path = nullptr;
+            break;
+        }
+    }
+    if (path == nullptr || passes < 1) {
+        fprintf(stderr, "usage: %s log [-n passes]\n", argv[0]);
+        return 1;
+    }
+
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        perror(path);
+        return 1;
+    }
+    size_t size = info.st_size;
+    const uint8_t* log = nullptr;
+    if (size > 0) {
+        void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED) {
+            perror(path);
+            return 1;
+        }
+        log = (const uint8_t*) mapped;
+    }
+    close(fd);
+
+    const size_t header = sizeof(Recorder::magic) + 1;
+    if (size < header || memcmp(log, Recorder::magic, sizeof(Recorder::magic)) != 0
+            || log[sizeof(Recorder::magic)] != Recorder::version) {
+        fprintf(stderr, "%s: not a version %u kindling log\n", path, Recorder::version);
+        return 1;
+    }
+
+    Host::quiet() = true;
+    Replay::Reader reader = { log + header, log + size, false };
+
+    for (long pass = 0; pass < passes; pass++) {
+        Replay::Counts counts = {};
+        bool first = pass == 0;
+        uint32_t shows = Replay::shows();
+
+        auto begin = std::chrono::steady_clock::now();
+        bool ok = Replay::play(reader, Host::clock(), first, counts);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        if (!ok) {
+            fprintf(stderr, "%s: bad record after %llu records\n", path, (unsigned long long) counts.records);
+            return 1;
+        }
+
+        uint64_t updates = counts.actions + counts.ticks;
+        printf("pass %ld: %llu records, %llu actions, %llu staged, %llu ticks in %.3fms, %.0f updates/s\n",
+            pass + 1, (unsigned long long) counts.records, (unsigned long long) counts.actions,
+            (unsigned long long) counts.staged, (unsigned long long) counts.ticks,
+            seconds * 1e3, seconds > 0 ? updates / seconds : 0.0);
+        if (first && counts.frames > 0) {
+            uint32_t shown = Replay::shows() - shows;
+            printf("  %llu frames logged, %u shown, %llu differ\n",
+                (unsigned long long) counts.frames, shown, (unsigned long long) counts.mismatches);
+            if (counts.mismatches > 0 || counts.frames != shown) {
+                return 2;
+            }
+        }
+    }
+
+    munmap((void*) log, size);
+    return 0;
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+
+# Builds main.cpp for Linux against the Arduino and Adafruit_NeoPixel
+# stand-ins in this directory. Regenerate main.cpp with ../build.sh first.
+
+set -e
+
+cd "$(dirname "$0")/.."
+mkdir -p build/host
+
+CXX="${CXX:-g++}"
+CXXFLAGS="${CXXFLAGS:--O2 -g}"
+
+$CXX -std=c++17 $CXXFLAGS -Ihost main.cpp host/Host.cpp -o build/host/kindling
+$CXX -std=c++17 $CXXFLAGS -Ihost host/Bench.cpp -o build/host/kindling-bench -lpthread
+$CXX -std=c++17 $CXXFLAGS -Ihost host/Replay.cpp -o build/host/kindling-replay -lpthread
@@ -726,6 +726,15 @@ namespace juniper
 #include <Arduino.h>
 #include <Arduino.h>
 #include <Adafruit_NeoPixel.h>
+#include "Kernels.h"
+#include "Workers.h"
+#include "Queue.h"
+#include "Effects.h"
+#include "Palette.h"
+#include "Matrix.h"
+#include "Frames.h"
+#include "Recorder.h"
+#include "Streams.h"
 
 namespace Prelude {}
 namespace List {}
@@ -960,45 +969,59 @@ namespace juniper {
             }
         };
 
-        template<typename T1,typename T2,typename T3,typename T4,typename T5>
+        template<typename T1,typename T2,typename T3,typename T4,typename T5,typename T6,typename T7,typename T8,typename T9,typename T10,typename T11,typename T12,typename T13,typename T14,typename T15,typename T16,typename T17,typename T18>
         struct recordt_9 {
-            T1 device;
-            T2 operation;
-            T3 pin;
-            T4 pixels;
-            T5 previousPixels;
+            T1 arena;
+            T2 brightness;
+            T3 clean;
+            T4 deferred;
+            T5 device;
+            T6 fade;
+            T7 frames;
+            T8 gammaCorrect;
+            T9 length;
+            T10 levels;
+            T11 matrix;
+            T12 offset;
+            T13 operation;
+            T14 painted;
+            T15 pending;
+            T16 pin;
+            T17 start;
+            T18 unsent;
 
             recordt_9() {}
 
-            recordt_9(T1 init_device, T2 init_operation, T3 init_pin, T4 init_pixels, T5 init_previousPixels)
-                : device(init_device), operation(init_operation), pin(init_pin), pixels(init_pixels), previousPixels(init_previousPixels) {}
+            recordt_9(T1 init_arena, T2 init_brightness, T3 init_clean, T4 init_deferred, T5 init_device, T6 init_fade, T7 init_frames, T8 init_gammaCorrect, T9 init_length, T10 init_levels, T11 init_matrix, T12 init_offset, T13 init_operation, T14 init_painted, T15 init_pending, T16 init_pin, T17 init_start, T18 init_unsent)
+                : arena(init_arena), brightness(init_brightness), clean(init_clean), deferred(init_deferred), device(init_device), fade(init_fade), frames(init_frames), gammaCorrect(init_gammaCorrect), length(init_length), levels(init_levels), matrix(init_matrix), offset(init_offset), operation(init_operation), painted(init_painted), pending(init_pending), pin(init_pin), start(init_start), unsent(init_unsent) {}
 
-            bool operator==(recordt_9<T1, T2, T3, T4, T5> rhs) {
-                return true && device == rhs.device && operation == rhs.operation && pin == rhs.pin && pixels == rhs.pixels && previousPixels == rhs.previousPixels;
+            bool operator==(recordt_9<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17, T18> rhs) {
+                return true && arena == rhs.arena && brightness == rhs.brightness && clean == rhs.clean && deferred == rhs.deferred && device == rhs.device && fade == rhs.fade && frames == rhs.frames && gammaCorrect == rhs.gammaCorrect && length == rhs.length && levels == rhs.levels && matrix == rhs.matrix && offset == rhs.offset && operation == rhs.operation && painted == rhs.painted && pending == rhs.pending && pin == rhs.pin && start == rhs.start && unsent == rhs.unsent;
             }
 
-            bool operator!=(recordt_9<T1, T2, T3, T4, T5> rhs) {
+            bool operator!=(recordt_9<T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16, T17, T18> rhs) {
                 return !(rhs == *this);
             }
         };
 
-        template<typename T1,typename T2,typename T3,typename T4>
+
+
+        template<typename T1,typename T2,typename T3>
         struct recordt_8 {
             T1 endAfter;
             T2 function;
             T3 interval;
-            T4 timer;
 
             recordt_8() {}
 
-            recordt_8(T1 init_endAfter, T2 init_function, T3 init_interval, T4 init_timer)
-                : endAfter(init_endAfter), function(init_function), interval(init_interval), timer(init_timer) {}
+            recordt_8(T1 init_endAfter, T2 init_function, T3 init_interval)
+                : endAfter(init_endAfter), function(init_function), interval(init_interval) {}
 
-            bool operator==(recordt_8<T1, T2, T3, T4> rhs) {
-                return true && endAfter == rhs.endAfter && function == rhs.function && interval == rhs.interval && timer == rhs.timer;
+            bool operator==(recordt_8<T1, T2, T3> rhs) {
+                return true && endAfter == rhs.endAfter && function == rhs.function && interval == rhs.interval;
             }
 
-            bool operator!=(recordt_8<T1, T2, T3, T4> rhs) {
+            bool operator!=(recordt_8<T1, T2, T3> rhs) {
                 return !(rhs == *this);
             }
         };
@@ -1041,57 +1064,127 @@ namespace juniper {
             }
         };
 
-        template<typename T1>
+        template<typename T1,typename T2>
         struct recordt_10 {
             T1 lines;
+            T2 schedule;
 
             recordt_10() {}
 
-            recordt_10(T1 init_lines)
-                : lines(init_lines) {}
+            recordt_10(T1 init_lines, T2 init_schedule)
+                : lines(init_lines), schedule(init_schedule) {}
 
-            bool operator==(recordt_10<T1> rhs) {
-                return true && lines == rhs.lines;
+            bool operator==(recordt_10<T1, T2> rhs) {
+                return true && lines == rhs.lines && schedule == rhs.schedule;
             }
 
-            bool operator!=(recordt_10<T1> rhs) {
+            bool operator!=(recordt_10<T1, T2> rhs) {
                 return !(rhs == *this);
             }
         };
 
-        template<typename T1>
+        template<typename T1,typename T2>
         struct recordt_7 {
-            T1 pin;
+            T1 length;
+            T2 pin;
 
             recordt_7() {}
 
-            recordt_7(T1 init_pin)
-                : pin(init_pin) {}
+            recordt_7(T1 init_length, T2 init_pin)
+                : length(init_length), pin(init_pin) {}
 
-            bool operator==(recordt_7<T1> rhs) {
-                return true && pin == rhs.pin;
+            bool operator==(recordt_7<T1, T2> rhs) {
+                return true && length == rhs.length && pin == rhs.pin;
             }
 
-            bool operator!=(recordt_7<T1> rhs) {
+            bool operator!=(recordt_7<T1, T2> rhs) {
                 return !(rhs == *this);
             }
         };
 
+        template<typename T1,typename T2>
+        struct recordt_11 {
+            T1 length;
+            T2 start;
 
-    }
-}
+            recordt_11() {}
 
-namespace juniper {
-    namespace closures {
-        template<typename T1>
-        struct closuret_8 {
-            T1 color;
+            recordt_11(T1 init_length, T2 init_start)
+                : length(init_length), start(init_start) {}
+
+            bool operator==(recordt_11<T1, T2> rhs) {
+                return true && length == rhs.length && start == rhs.start;
+            }
+
+            bool operator!=(recordt_11<T1, T2> rhs) {
+                return !(rhs == *this);
+            }
+        };
+
+        template<typename T1,typename T2>
+        struct recordt_12 {
+            T1 line;
+            T2 time;
+
+            recordt_12() {}
+
+            recordt_12(T1 init_line, T2 init_time)
+                : line(init_line), time(init_time) {}
+
+            bool operator==(recordt_12<T1, T2> rhs) {
+                return true && line == rhs.line && time == rhs.time;
+            }
+
+            bool operator!=(recordt_12<T1, T2> rhs) {
+                return !(rhs == *this);
+            }
+        };
 
+        template<typename T1,typename T2,typename T3>
+        struct recordt_13 {
+            T1 finish;
+            T2 last;
+            T3 target;
+
+            recordt_13() {}
+
+            recordt_13(T1 init_finish, T2 init_last, T3 init_target)
+                : finish(init_finish), last(init_last), target(init_target) {}
+
+            bool operator==(recordt_13<T1, T2, T3> rhs) {
+                return true && finish == rhs.finish && last == rhs.last && target == rhs.target;
+            }
+
+            bool operator!=(recordt_13<T1, T2, T3> rhs) {
+                return !(rhs == *this);
+            }
+        };
+
+        template<typename T1,typename T2>
+        struct recordt_14 {
+            T1 pixels;
+            T2 previousPixels;
+
+            recordt_14() {}
 
-            closuret_8(T1 init_color) :
-                color(init_color) {}
+            recordt_14(T1 init_pixels, T2 init_previousPixels)
+                : pixels(init_pixels), previousPixels(init_previousPixels) {}
+
+            bool operator==(recordt_14<T1, T2> rhs) {
+                return true && pixels == rhs.pixels && previousPixels == rhs.previousPixels;
+            }
+
+            bool operator!=(recordt_14<T1, T2> rhs) {
+                return !(rhs == *this);
+            }
         };
 
+
+    }
+}
+
+namespace juniper {
+    namespace closures {
         template<typename T1>
         struct closuret_1 {
             T1 f;
@@ -1111,16 +1204,6 @@ namespace juniper {
                 f(init_f), g(init_g) {}
         };
 
-        template<typename T1,typename T2>
-        struct closuret_6 {
-            T1 f;
-            T2 operation;
-
-
-            closuret_6(T1 init_f, T2 init_operation) :
-                f(init_f), operation(init_operation) {}
-        };
-
         template<typename T1,typename T2>
         struct closuret_2 {
             T1 f;
@@ -1142,15 +1225,6 @@ namespace juniper {
                 f(init_f), valueA(init_valueA), valueB(init_valueB) {}
         };
 
-        template<typename T1>
-        struct closuret_9 {
-            T1 line;
-
-
-            closuret_9(T1 init_line) :
-                line(init_line) {}
-        };
-
         template<typename T1>
         struct closuret_10 {
             T1 model;
@@ -1162,11 +1236,11 @@ namespace juniper {
 
         template<typename T1>
         struct closuret_7 {
-            T1 operation;
+            T1 arena;
 
 
-            closuret_7(T1 init_operation) :
-                operation(init_operation) {}
+            closuret_7(T1 init_arena) :
+                arena(init_arena) {}
         };
 
         template<typename T1>
@@ -1188,6 +1262,14 @@ namespace juniper {
                 val1(init_val1), val2(init_val2) {}
         };
 
+        template<typename T1>
+        struct closuret_11 {
+            T1 lines;
+
+
+            closuret_11(T1 init_lines) :
+                lines(init_lines) {}
+        };
 
     }
 }
@@ -1546,63 +1628,57 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    using DeviceDescriptor = juniper::records::recordt_7<uint16_t>;
+    using DeviceDescriptor = juniper::records::recordt_7<uint16_t, uint16_t>;
 
 
 }
 
 namespace NeoPixel {
-    struct color {
-        juniper::variant<juniper::tuple3<uint8_t, uint8_t, uint8_t>> data;
-
-        color() {}
-
-        color(juniper::variant<juniper::tuple3<uint8_t, uint8_t, uint8_t>> initData) : data(initData) {}
-
-        juniper::tuple3<uint8_t, uint8_t, uint8_t> RGB() {
-            return data.template get<0>();
-        }
-
-        uint8_t id() {
-            return data.id();
-        }
-
-        bool operator==(color rhs) {
-            return data == rhs.data;
-        }
-
-        bool operator!=(color rhs) {
-            return !(this->operator==(rhs));
-        }
-    };
-
-    NeoPixel::color RGB(uint8_t data0, uint8_t data1, uint8_t data2) {
-        return NeoPixel::color(juniper::variant<juniper::tuple3<uint8_t, uint8_t, uint8_t>>::template create<0>(juniper::tuple3<uint8_t, uint8_t, uint8_t>(data0, data1, data2)));
-    }
+    using color = uint32_t;
 
 
 }
 
 namespace NeoPixel {
     struct Function {
-        juniper::variant<int16_t, NeoPixel::color, juniper::tuple2<NeoPixel::color, NeoPixel::color>> data;
+        juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t> data;
 
         Function() {}
 
-        Function(juniper::variant<int16_t, NeoPixel::color, juniper::tuple2<NeoPixel::color, NeoPixel::color>> initData) : data(initData) {}
+        Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t> initData) : data(initData) {}
 
         int16_t rotate() {
             return data.template get<0>();
         }
 
-        NeoPixel::color set() {
+        uint32_t set() {
             return data.template get<1>();
         }
 
-        juniper::tuple2<NeoPixel::color, NeoPixel::color> alternate() {
+        juniper::tuple2<uint32_t, uint32_t> alternate() {
             return data.template get<2>();
         }
 
+        uint8_t effect() {
+            return data.template get<3>();
+        }
+
+        juniper::tuple2<uint32_t, uint32_t> fade() {
+            return data.template get<4>();
+        }
+
+        juniper::tuple2<uint32_t, uint32_t> gradient() {
+            return data.template get<5>();
+        }
+
+        juniper::tuple2<uint8_t, uint8_t> rainbow() {
+            return data.template get<6>();
+        }
+
+        uint8_t stream() {
+            return data.template get<7>();
+        }
+
         uint8_t id() {
             return data.id();
         }
@@ -1617,15 +1693,35 @@ namespace NeoPixel {
     };
 
     NeoPixel::Function rotate(int16_t data0) {
-        return NeoPixel::Function(juniper::variant<int16_t, NeoPixel::color, juniper::tuple2<NeoPixel::color, NeoPixel::color>>::template create<0>(data0));
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<0>(data0));
+    }
+
+    NeoPixel::Function set(uint32_t data0) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<1>(data0));
+    }
+
+    NeoPixel::Function alternate(uint32_t data0, uint32_t data1) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<2>(juniper::tuple2<uint32_t, uint32_t>(data0, data1)));
+    }
+
+    NeoPixel::Function effect(uint8_t data0) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<3>(data0));
+    }
+
+    NeoPixel::Function fade(uint32_t data0, uint32_t data1) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<4>(juniper::tuple2<uint32_t, uint32_t>(data0, data1)));
+    }
+
+    NeoPixel::Function gradient(uint32_t data0, uint32_t data1) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<5>(juniper::tuple2<uint32_t, uint32_t>(data0, data1)));
     }
 
-    NeoPixel::Function set(NeoPixel::color data0) {
-        return NeoPixel::Function(juniper::variant<int16_t, NeoPixel::color, juniper::tuple2<NeoPixel::color, NeoPixel::color>>::template create<1>(data0));
+    NeoPixel::Function rainbow(uint8_t data0, uint8_t data1) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<6>(juniper::tuple2<uint8_t, uint8_t>(data0, data1)));
     }
 
-    NeoPixel::Function alternate(NeoPixel::color data0, NeoPixel::color data1) {
-        return NeoPixel::Function(juniper::variant<int16_t, NeoPixel::color, juniper::tuple2<NeoPixel::color, NeoPixel::color>>::template create<2>(juniper::tuple2<NeoPixel::color, NeoPixel::color>(data0, data1)));
+    NeoPixel::Function stream(uint8_t data0) {
+        return NeoPixel::Function(juniper::variant<int16_t, uint32_t, juniper::tuple2<uint32_t, uint32_t>, uint8_t, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint32_t, uint32_t>, juniper::tuple2<uint8_t, uint8_t>, uint8_t>::template create<7>(data0));
     }
 
 
@@ -1633,11 +1729,11 @@ namespace NeoPixel {
 
 namespace NeoPixel {
     struct Action {
-        juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t> data;
+        juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>> data;
 
         Action() {}
 
-        Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t> initData) : data(initData) {}
+        Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>> initData) : data(initData) {}
 
         uint8_t start() {
             return data.template get<0>();
@@ -1655,6 +1751,26 @@ namespace NeoPixel {
             return data.template get<3>();
         }
 
+        juniper::tuple2<uint8_t, uint8_t> brightness() {
+            return data.template get<4>();
+        }
+
+        juniper::tuple2<uint8_t, bool> gammaCorrect() {
+            return data.template get<5>();
+        }
+
+        juniper::tuple2<uint8_t, uint32_t> paletteColor() {
+            return data.template get<6>();
+        }
+
+        int16_t rotatePalette() {
+            return data.template get<7>();
+        }
+
+        juniper::tuple2<uint8_t, uint8_t> matrix() {
+            return data.template get<8>();
+        }
+
         uint8_t id() {
             return data.id();
         }
@@ -1669,42 +1785,79 @@ namespace NeoPixel {
     };
 
     NeoPixel::Action start() {
-        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t>::template create<0>(0));
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<0>(0));
     }
 
     NeoPixel::Action run(uint8_t data0, NeoPixel::Function data1) {
-        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t>::template create<1>(juniper::tuple2<uint8_t, NeoPixel::Function>(data0, data1)));
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<1>(juniper::tuple2<uint8_t, NeoPixel::Function>(data0, data1)));
     }
 
     NeoPixel::Action repeat(uint8_t data0, NeoPixel::Function data1, uint32_t data2, Prelude::maybe<uint8_t> data3) {
-        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t>::template create<2>(juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>(data0, data1, data2, data3)));
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<2>(juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>(data0, data1, data2, data3)));
     }
 
     NeoPixel::Action endRepeat(uint8_t data0) {
-        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t>::template create<3>(data0));
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<3>(data0));
+    }
+
+    NeoPixel::Action brightness(uint8_t data0, uint8_t data1) {
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<4>(juniper::tuple2<uint8_t, uint8_t>(data0, data1)));
+    }
+
+    NeoPixel::Action gammaCorrect(uint8_t data0, bool data1) {
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<5>(juniper::tuple2<uint8_t, bool>(data0, data1)));
+    }
+
+    NeoPixel::Action paletteColor(uint8_t data0, uint32_t data1) {
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<6>(juniper::tuple2<uint8_t, uint32_t>(data0, data1)));
+    }
+
+    NeoPixel::Action rotatePalette(int16_t data0) {
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<7>(data0));
+    }
+
+    NeoPixel::Action matrix(uint8_t data0, uint8_t data1) {
+        return NeoPixel::Action(juniper::variant<uint8_t, juniper::tuple2<uint8_t, NeoPixel::Function>, juniper::tuple4<uint8_t, NeoPixel::Function, uint32_t, Prelude::maybe<uint8_t>>, uint8_t, juniper::tuple2<uint8_t, uint8_t>, juniper::tuple2<uint8_t, bool>, juniper::tuple2<uint8_t, uint32_t>, int16_t, juniper::tuple2<uint8_t, uint8_t>>::template create<8>(juniper::tuple2<uint8_t, uint8_t>(data0, data1)));
     }
 
 
 }
 
 namespace NeoPixel {
-    using Operation = juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>;
+    using Operation = juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>;
+
 
+}
+
+namespace NeoPixel {
+    using Fade = juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>;
+}
 
+namespace NeoPixel {
+    template<typename pixel, int nPixels>
+    using Arena = juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>, juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>>;
 }
 
 namespace NeoPixel {
-    template<int nPixels>
-    using Line = juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, nPixels>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, nPixels>, uint32_t>>;
+    template<typename pixel, int nPixels>
+    using Line = juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>, juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>;
 
 
 }
 
 namespace NeoPixel {
-    template<int nLines, int nPixels>
-    using Model = juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, nPixels>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, nPixels>, uint32_t>>>, nLines>, uint32_t>>;
+    template<typename pixel, int nLines, int nPixels>
+    using Model = juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>, juniper::records::recordt_0<juniper::array<pixel, nPixels>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, nLines>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, nLines>, uint32_t>>;
+
+
+}
 
+namespace NeoPixel {
+    using Due = juniper::records::recordt_12<uint8_t, uint32_t>;
+}
 
+namespace NeoPixel {
+    using Span = juniper::records::recordt_11<uint16_t, uint16_t>;
 }
 
 namespace NeoPixel {
@@ -2982,21 +3135,52 @@ namespace SignalExt {
 }
 
 namespace NeoPixel {
-    Prelude::sig<Prelude::maybe<NeoPixel::Action>> actions(Prelude::maybe<NeoPixel::Action>& prevAction);
+    bool queueAction(NeoPixel::Action action);
+}
+
+namespace NeoPixel {
+    Prelude::maybe<NeoPixel::Action> nextAction();
+}
+
+namespace NeoPixel {
+    template<typename t5000, int c294, int c295>
+    juniper::unit drainActions(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>> model);
+}
+
+namespace NeoPixel {
+    template<typename t5001, int c296, int c297>
+    juniper::unit stageAction(NeoPixel::Action action, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5001, c297>, uint32_t>, juniper::records::recordt_0<juniper::array<t5001, c297>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c296>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c296>, uint32_t>>> model);
+}
+
+namespace NeoPixel {
+    uint32_t RGB(uint8_t r, uint8_t g, uint8_t b);
+}
+
+namespace NeoPixel {
+    uint32_t HSV(uint16_t hue, uint8_t saturation, uint8_t value);
+}
+
+namespace NeoPixel {
+    template<int c301>
+    bool loadEffect(uint8_t slot, juniper::records::recordt_0<juniper::array<uint8_t, c301>, uint32_t> code);
+}
+
+namespace NeoPixel {
+    bool loadMatrix(uint8_t slot, uint16_t width, uint16_t height, uint8_t order, uint8_t tilesAcross, uint8_t tilesDown, uint8_t tileOrder);
 }
 
 namespace NeoPixel {
-    NeoPixel::color getPixelColor(uint16_t n, NeoPixel::RawDevice line);
+    uint32_t getPixelColor(uint16_t n, NeoPixel::RawDevice line);
 }
 
 namespace NeoPixel {
-    template<int c253>
-    juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t> readPixels(Prelude::maybe<NeoPixel::RawDevice> device);
+    template<typename t5002, int c253>
+    juniper::unit readPixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5002, c253>, uint32_t>, juniper::records::recordt_0<juniper::array<t5002, c253>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
 }
 
 namespace NeoPixel {
-    template<int c256, int c257>
-    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>> initialState(juniper::array<juniper::records::recordt_7<uint16_t>, c257> descriptors, uint16_t nPixels);
+    template<typename t5003, int c256, int c257>
+    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>> initialState(juniper::array<juniper::records::recordt_7<uint16_t, uint16_t>, c257> descriptors);
 }
 
 namespace NeoPixel {
@@ -3004,26 +3188,91 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    template<typename t4552>
-    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> runOperation(juniper::function<t4552, juniper::unit(NeoPixel::Function)> f, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> operation);
+    void * makeFrames();
+}
+
+namespace NeoPixel {
+    juniper::unit watchClock(uint32_t now);
+}
+
+namespace NeoPixel {
+    bool reached(uint32_t time, uint32_t now);
+}
+
+namespace NeoPixel {
+    uint32_t nextDue(uint32_t last, uint32_t interval);
+}
+
+namespace NeoPixel {
+    uint32_t urgency(juniper::records::recordt_12<uint8_t, uint32_t> due);
+}
+
+namespace NeoPixel {
+    template<int c287>
+    juniper::unit siftUp(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c287>, uint32_t>& schedule, uint32_t i);
+}
+
+namespace NeoPixel {
+    template<int c288>
+    uint32_t findDue(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c288>, uint32_t> schedule, uint8_t line);
+}
+
+namespace NeoPixel {
+    template<int c289>
+    juniper::unit removeDue(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c289>, uint32_t>& schedule, uint32_t i);
+}
+
+namespace NeoPixel {
+    template<int c290>
+    juniper::unit scheduleLine(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c290>, uint32_t>& schedule, uint8_t line, uint32_t time);
+}
+
+namespace NeoPixel {
+    template<int c291>
+    juniper::unit unscheduleLine(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c291>, uint32_t>& schedule, uint8_t line);
+}
+
+namespace NeoPixel {
+    template<typename t5004, int c298, int c299>
+    juniper::unit startOperation(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5004, c299>, uint32_t>, juniper::records::recordt_0<juniper::array<t5004, c299>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c298>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c298>, uint32_t>>> model, uint8_t line, NeoPixel::Function fn, uint32_t interval, Prelude::maybe<uint8_t> endAfter, uint32_t first);
+}
+
+namespace NeoPixel {
+    template<typename t5005, int c292, int c293>
+    juniper::unit runDue(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>, juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c292>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c292>, uint32_t>>> model);
+}
+
+namespace NeoPixel {
+    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> updateOperation(Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> operation);
 }
 
 namespace NeoPixel {
-    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> updateOperation(Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> operation);
+    template<typename t5006, int c260>
+    juniper::unit applyFunction(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5006, c260>, uint32_t>, juniper::records::recordt_0<juniper::array<t5006, c260>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
 }
 
 namespace NeoPixel {
-    template<int c260>
-    juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> applyFunction(NeoPixel::Function fn, juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> pixels);
+    template<typename t5023, int c308>
+    bool leavesPixels(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5023, c308>, uint32_t>, juniper::records::recordt_0<juniper::array<t5023, c308>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
 }
 
 namespace NeoPixel {
-    template<int c265>
-    juniper::records::recordt_0<juniper::array<Prelude::maybe<NeoPixel::color>, c265>, uint32_t> diffPixels(juniper::records::recordt_0<juniper::array<NeoPixel::color, c265>, uint32_t> current, juniper::records::recordt_0<juniper::array<NeoPixel::color, c265>, uint32_t> next);
+    template<typename t5022, int c307>
+    juniper::unit paintLine(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5022, c307>, uint32_t>, juniper::records::recordt_0<juniper::array<t5022, c307>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
 }
 
 namespace NeoPixel {
-    juniper::unit setPixelColor(uint16_t n, NeoPixel::color color, NeoPixel::RawDevice line);
+    template<typename t5007, int c302>
+    juniper::unit stepFade(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5007, c302>, uint32_t>, juniper::records::recordt_0<juniper::array<t5007, c302>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, uint32_t target, uint32_t duration);
+}
+
+namespace NeoPixel {
+    template<typename t5008, int c265>
+    juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> diffPixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5008, c265>, uint32_t>, juniper::records::recordt_0<juniper::array<t5008, c265>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, uint32_t from);
+}
+
+namespace NeoPixel {
+    juniper::unit setPixelColor(uint16_t n, uint32_t color, NeoPixel::RawDevice line);
 }
 
 namespace NeoPixel {
@@ -3031,13 +3280,81 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    template<int c268>
-    juniper::unit writePixels(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>> line);
+    template<typename t5009, int c268>
+    bool writePixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5009, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<t5009, c268>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5021, int c306>
+    bool writeSpans(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5021, c306>, uint32_t>, juniper::records::recordt_0<juniper::array<t5021, c306>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t> makeLevels(uint8_t brightness, bool gammaCorrect);
+}
+
+namespace NeoPixel {
+    template<typename t5010, int c280>
+    juniper::unit refreshLevels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5010, c280>, uint32_t>, juniper::records::recordt_0<juniper::array<t5010, c280>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5019, int c303>
+    juniper::unit resendLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5019, c303>, uint32_t>, juniper::records::recordt_0<juniper::array<t5019, c303>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5025, int c310>
+    juniper::unit showResent(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5025, c310>, uint32_t>, juniper::records::recordt_0<juniper::array<t5025, c310>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5020, int c304, int c305>
+    juniper::unit refreshPalette(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>, juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c304>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c304>, uint32_t>>> model);
 }
 
 namespace NeoPixel {
-    template<int c272>
-    juniper::unit updateLine(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c272>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c272>, uint32_t>>> line, NeoPixel::Function fn);
+    Prelude::maybe<NeoPixel::Function> foldFunctions(NeoPixel::Function first, NeoPixel::Function second);
+}
+
+namespace NeoPixel {
+    template<typename t5011, int c300>
+    juniper::unit stageFunction(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5011, c300>, uint32_t>, juniper::records::recordt_0<juniper::array<t5011, c300>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn);
+}
+
+namespace NeoPixel {
+    template<typename t5024, int c309>
+    juniper::unit flushLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5024, c309>, uint32_t>, juniper::records::recordt_0<juniper::array<t5024, c309>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5012, int c272>
+    juniper::unit updateLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5012, c272>, uint32_t>, juniper::records::recordt_0<juniper::array<t5012, c272>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn);
+}
+
+namespace NeoPixel {
+    template<typename t5013, int c281>
+    bool renderLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5013, c281>, uint32_t>, juniper::records::recordt_0<juniper::array<t5013, c281>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn);
+}
+
+namespace NeoPixel {
+    template<typename t5014, int c286>
+    bool commitLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5014, c286>, uint32_t>, juniper::records::recordt_0<juniper::array<t5014, c286>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5015, int c282>
+    juniper::unit showLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5015, c282>, uint32_t>, juniper::records::recordt_0<juniper::array<t5015, c282>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, bool changed);
+}
+
+namespace NeoPixel {
+    template<typename t5016, int c283>
+    Prelude::maybe<bool> renderPending(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5016, c283>, uint32_t>, juniper::records::recordt_0<juniper::array<t5016, c283>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line);
+}
+
+namespace NeoPixel {
+    template<typename t5017, int c284, int c285>
+    juniper::unit renderLines(juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t> lines);
 }
 
 namespace NeoPixel {
@@ -3045,12 +3362,11 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    template<int c275, int c276>
-    juniper::unit update(Prelude::maybe<NeoPixel::Action> act, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>> model);
+    template<typename t5018, int c275, int c276>
+    juniper::unit update(Prelude::maybe<NeoPixel::Action> act, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>> model);
 }
 
 namespace NeoPixel {
-    juniper::unit setBrightness(uint8_t level, NeoPixel::RawDevice line);
 }
 
 namespace NeoPixel {
@@ -3137,14 +3453,23 @@ namespace NeoPixel {
     extern Prelude::maybe<NeoPixel::Action> startAction;
 }
 
-namespace TEA {
-    extern juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, 150>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, 150>, uint32_t>>>, 1>, uint32_t>>> state;
+namespace NeoPixel {
+    extern uint32_t suppressedShows;
+}
+
+namespace NeoPixel {
+    extern uint32_t diffWindow;
+}
+
+namespace NeoPixel {
+    extern uint32_t scheduleEpoch;
 }
 
 namespace TEA {
-    extern Prelude::maybe<NeoPixel::Action> previousAction;
+    extern juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<uint32_t, 150>, uint32_t>, juniper::records::recordt_0<juniper::array<uint32_t, 150>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, 1>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, 1>, uint32_t>>> state;
 }
 
+
 namespace Prelude {
     void * extractptr(juniper::rcptr p) {
         return (([&]() -> void * {
@@ -8656,390 +8981,1446 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    Prelude::sig<Prelude::maybe<NeoPixel::Action>> actions(Prelude::maybe<NeoPixel::Action>& prevAction) {
-        return (([&]() -> Prelude::sig<Prelude::maybe<NeoPixel::Action>> {
-            return Signal::meta<NeoPixel::Action>(Signal::mergeMany<NeoPixel::Action, 2>((([&]() -> juniper::records::recordt_0<juniper::array<Prelude::sig<NeoPixel::Action>, 2>, uint32_t>{
-                juniper::records::recordt_0<juniper::array<Prelude::sig<NeoPixel::Action>, 2>, uint32_t> guid240;
-                guid240.data = (juniper::array<Prelude::sig<NeoPixel::Action>, 2> { {SignalExt::once<NeoPixel::Action>(startAction), SignalExt::once<NeoPixel::Action>(prevAction)} });
-                guid240.length = ((uint32_t) 2);
-                return guid240;
-            })())));
+    uint32_t suppressedShows = ((uint32_t) 0);
+}
+
+namespace NeoPixel {
+    uint32_t diffWindow = ((uint32_t) 256);
+}
+
+namespace NeoPixel {
+    uint32_t scheduleEpoch = ((uint32_t) 0);
+}
+
+namespace NeoPixel {
+    bool queueAction(NeoPixel::Action action) {
+        return (([&]() -> bool {
+            bool queued;
+            
+            (([&]() -> juniper::unit {
+                 queued = Queue::Actions<NeoPixel::Action>::ring.push(action); 
+                return {};
+            })());
+            return queued;
         })());
     }
 }
 
 namespace NeoPixel {
-    NeoPixel::color getPixelColor(uint16_t n, NeoPixel::RawDevice line) {
-        return (([&]() -> NeoPixel::color {
-            NeoPixel::RawDevice guid241 = line;
-            if (!(((bool) (((bool) ((guid241).id() == ((uint8_t) 0))) && true)))) {
-                juniper::quit<juniper::unit>();
-            }
-            void * p = (guid241).device();
+    Prelude::maybe<NeoPixel::Action> nextAction() {
+        return (([&]() -> Prelude::maybe<NeoPixel::Action> {
+            NeoPixel::Action action;
             
-            uint32_t guid242 = ((uint32_t) 0);
-            if (!(true)) {
-                juniper::quit<juniper::unit>();
-            }
-            uint32_t numRep = guid242;
+            bool received;
             
             (([&]() -> juniper::unit {
-                 numRep = ((Adafruit_NeoPixel*) p)->getPixelColor(n); 
+                 received = Queue::Actions<NeoPixel::Action>::ring.pop(action); 
                 return {};
             })());
-            return RGB(toUInt8<uint32_t>(((uint32_t) (numRep >> ((uint32_t) 16)))), toUInt8<uint32_t>(((uint32_t) (numRep >> ((uint32_t) 8)))), toUInt8<uint32_t>(numRep));
+            return (received ? 
+                (([&]() -> Prelude::maybe<NeoPixel::Action> {
+                    return just<NeoPixel::Action>(action);
+                })())
+            :
+                (([&]() -> Prelude::maybe<NeoPixel::Action> {
+                    return nothing<NeoPixel::Action>();
+                })()));
         })());
     }
 }
 
 namespace NeoPixel {
-    template<int c253>
-    juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t> readPixels(Prelude::maybe<NeoPixel::RawDevice> device) {
-        return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t> {
-            constexpr int32_t n = c253;
-            return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t> {
-                uint32_t guid243 = ((uint32_t) 0);
+    template<typename t5000, int c294, int c295>
+    juniper::unit drainActions(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>> model) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nLines = c294;
+            constexpr int32_t nPixels = c295;
+            return (([&]() -> juniper::unit {
+                Signal::sink<NeoPixel::Action, juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>>>>(juniper::function<juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>>>, juniper::unit(NeoPixel::Action)>(juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>>>(model), [](juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>>>& junclosure, NeoPixel::Action action) -> juniper::unit { 
+                    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>, juniper::records::recordt_0<juniper::array<t5000, c295>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c294>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c294>, uint32_t>>>& model = junclosure.model;
+                    return update<t5000, c294, c295>(just<NeoPixel::Action>(action), model);
+                 }), SignalExt::once<NeoPixel::Action>(startAction));
+                uint32_t guid294 = ((uint32_t) 0);
                 if (!(true)) {
                     juniper::quit<juniper::unit>();
                 }
-                uint32_t color = guid243;
+                uint32_t n = guid294;
                 
-                juniper::array<NeoPixel::color, c253> guid244 = zeros<NeoPixel::color, c253>();
+                bool guid295 = true;
                 if (!(true)) {
                     juniper::quit<juniper::unit>();
                 }
-                juniper::array<NeoPixel::color, c253> pixels = guid244;
+                bool more = guid295;
                 
+                uint32_t batch;
+                
+                (([&]() -> juniper::unit {
+                     batch = Queue::actionCapacity; 
+                    return {};
+                })());
                 (([&]() -> juniper::unit {
-                    Prelude::maybe<NeoPixel::RawDevice> guid245 = device;
-                    return (((bool) (((bool) ((guid245).id() == ((uint8_t) 0))) && true)) ? 
+                    while (((bool) (more && ((bool) (n < batch))))) {
                         (([&]() -> juniper::unit {
-                            NeoPixel::RawDevice device = (guid245).just();
-                            return (([&]() -> juniper::unit {
+                            Prelude::maybe<NeoPixel::Action> guid296 = nextAction();
+                            return (((bool) (((bool) ((guid296).id() == ((uint8_t) 0))) && true)) ? 
                                 (([&]() -> juniper::unit {
-                                    uint16_t guid246 = ((uint16_t) 0);
-                                    uint16_t guid247 = cast<int32_t, uint16_t>(n);
-                                    for (uint16_t i = guid246; i < guid247; i++) {
-                                        (([&]() -> NeoPixel::color {
-                                            getPixelColor(i, device);
-                                            return ((pixels)[i] = RGB(toUInt8<uint32_t>(((uint32_t) (color >> ((uint32_t) 16)))), toUInt8<uint32_t>(((uint32_t) (color >> ((uint32_t) 8)))), toUInt8<uint32_t>(color)));
+                                    NeoPixel::Action action = (guid296).just();
+                                    return (([&]() -> juniper::unit {
+                                        stageAction<t5000, c294, c295>(action, model);
+                                        (n += ((uint32_t) 1));
+                                        return juniper::unit();
+                                    })());
+                                })())
+                            :
+                                (((bool) (((bool) ((guid296).id() == ((uint8_t) 1))) && true)) ? 
+                                    (([&]() -> juniper::unit {
+                                        return (([&]() -> juniper::unit {
+                                            (more = false);
+                                            return juniper::unit();
                                         })());
-                                    }
-                                    return {};
-                                })());
-                                return juniper::unit();
-                            })());
-                        })())
-                    :
-                        (((bool) (((bool) ((guid245).id() == ((uint8_t) 1))) && true)) ? 
-                            (([&]() -> juniper::unit {
-                                return juniper::unit();
-                            })())
-                        :
-                            juniper::quit<juniper::unit>()));
-                })());
-                return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t>{
-                    juniper::records::recordt_0<juniper::array<NeoPixel::color, c253>, uint32_t> guid248;
-                    guid248.data = pixels;
-                    guid248.length = cast<int32_t, uint32_t>(n);
-                    return guid248;
-                })());
-            })());
-        })());
-    }
-}
-
-namespace NeoPixel {
-    template<int c256, int c257>
-    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>> initialState(juniper::array<juniper::records::recordt_7<uint16_t>, c257> descriptors, uint16_t nPixels) {
-        return (([&]() -> juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>> {
-            constexpr int32_t m = c256;
-            constexpr int32_t nLines = c257;
-            return (([&]() -> juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>> {
-                return (juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>>((([&]() -> juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>>{
-                    juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, c257>, uint32_t>> guid249;
-                    guid249.lines = List::map<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>, void, juniper::records::recordt_7<uint16_t>, c257>(juniper::function<void, juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>(juniper::records::recordt_7<uint16_t>)>([](juniper::records::recordt_7<uint16_t> descriptor) -> juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>> { 
-                        return (([&]() -> juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>> {
-                            Prelude::maybe<NeoPixel::RawDevice> guid250 = nothing<NeoPixel::RawDevice>();
-                            if (!(true)) {
-                                juniper::quit<juniper::unit>();
-                            }
-                            Prelude::maybe<NeoPixel::RawDevice> device = guid250;
-                            
-                            juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t> guid251 = readPixels<c256>(device);
-                            if (!(true)) {
-                                juniper::quit<juniper::unit>();
-                            }
-                            juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t> pixels = guid251;
-                            
-                            return (juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>>((([&]() -> juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>>{
-                                juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c256>, uint32_t>> guid252;
-                                guid252.previousPixels = pixels;
-                                guid252.pixels = pixels;
-                                guid252.operation = nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>();
-                                guid252.pin = (descriptor).pin;
-                                guid252.device = device;
-                                return guid252;
-                            })())));
+                                    })())
+                                :
+                                    juniper::quit<juniper::unit>()));
                         })());
-                     }), (([&]() -> juniper::records::recordt_0<juniper::array<juniper::records::recordt_7<uint16_t>, c257>, uint32_t>{
-                        juniper::records::recordt_0<juniper::array<juniper::records::recordt_7<uint16_t>, c257>, uint32_t> guid253;
-                        guid253.data = descriptors;
-                        guid253.length = cast<int32_t, uint32_t>(nLines);
-                        return guid253;
-                    })()));
-                    return guid249;
-                })())));
-            })());
-        })());
-    }
-}
-
-namespace NeoPixel {
-    NeoPixel::RawDevice makeDevice(uint16_t pin, uint16_t pixels) {
-        return (([&]() -> NeoPixel::RawDevice {
-            void * ret;
-            
-            (([&]() -> juniper::unit {
-                 ret = new Adafruit_NeoPixel(pixels, pin, NEO_GRB + NEO_KHZ800); 
-                return {};
-            })());
-            return NeoPixel::device(ret);
-        })());
-    }
-}
-
-namespace NeoPixel {
-    template<typename t4552>
-    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> runOperation(juniper::function<t4552, juniper::unit(NeoPixel::Function)> f, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> operation) {
-        return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-            return Maybe::map<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>, juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>(juniper::function<juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>(juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>)>(juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>(f, operation), [](juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>& junclosure, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> operation) -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> { 
-                juniper::function<t4552, juniper::unit(NeoPixel::Function)>& f = junclosure.f;
-                Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>& operation = junclosure.operation;
-                return (([&]() -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> {
-                    juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> guid254 = operation;
-                    if (!(true)) {
-                        juniper::quit<juniper::unit>();
                     }
-                    juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> operation = guid254;
-                    
-                    Signal::sink<uint32_t, juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>(juniper::function<juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, juniper::unit(uint32_t)>(juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>(f, operation), [](juniper::closures::closuret_6<juniper::function<t4552, juniper::unit(NeoPixel::Function)>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>& junclosure, uint32_t _) -> juniper::unit { 
-                        juniper::function<t4552, juniper::unit(NeoPixel::Function)>& f = junclosure.f;
-                        juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>& operation = junclosure.operation;
-                        return (([&]() -> juniper::unit {
-                            return f((operation).function);
-                        })());
-                     }), Time::every((operation).interval, (operation).timer));
-                    return operation;
+                    return {};
                 })());
-             }), operation);
-        })());
-    }
-}
-
-namespace NeoPixel {
-    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> updateOperation(Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> operation) {
-        return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-            (([&]() -> juniper::unit {
-                 Serial.println("updateOperation"); 
-                return {};
+                return update<t5000, c294, c295>(nothing<NeoPixel::Action>(), model);
             })());
-            return MaybeExt::flatMap<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>, juniper::closures::closuret_7<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>(juniper::function<juniper::closures::closuret_7<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>(juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>)>(juniper::closures::closuret_7<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>(operation), [](juniper::closures::closuret_7<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>& junclosure, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> operation) -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> { 
-                Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>& operation = junclosure.operation;
-                return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                    return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                        Prelude::maybe<uint8_t> guid255 = (operation).endAfter;
-                        return (((bool) (((bool) ((guid255).id() == ((uint8_t) 0))) && ((bool) (((bool) ((guid255).just() == ((uint8_t) 0))) && true)))) ? 
-                            (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                                return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                                    return nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>();
-                                })());
-                            })())
-                        :
-                            (true ? 
-                                (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                                    return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>> {
-                                        return just<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>((([&]() -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>{
-                                            juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> guid256;
-                                            guid256.function = (operation).function;
-                                            guid256.interval = (operation).interval;
-                                            guid256.timer = (operation).timer;
-                                            guid256.endAfter = Maybe::map<uint8_t, void, uint8_t>(juniper::function<void, uint8_t(uint8_t)>([](uint8_t n) -> uint8_t { 
-                                                return (([&]() -> uint8_t {
-                                                    return Math::max_<uint8_t>(((uint8_t) 0), ((uint8_t) (n - ((uint8_t) 1))));
-                                                })());
-                                             }), (operation).endAfter);
-                                            return guid256;
-                                        })()));
-                                    })());
-                                })())
-                            :
-                                juniper::quit<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>>()));
-                    })());
-                })());
-             }), operation);
         })());
     }
 }
 
 namespace NeoPixel {
-    template<int c260>
-    juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> applyFunction(NeoPixel::Function fn, juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> pixels) {
-        return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-            constexpr int32_t nPixels = c260;
-            return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-                return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-                    NeoPixel::Function guid257 = fn;
-                    return (((bool) (((bool) ((guid257).id() == ((uint8_t) 0))) && true)) ? 
-                        (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-                            int16_t step = (guid257).rotate();
-                            return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
+    template<typename t5001, int c296, int c297>
+    juniper::unit stageAction(NeoPixel::Action action, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5001, c297>, uint32_t>, juniper::records::recordt_0<juniper::array<t5001, c297>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c296>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c296>, uint32_t>>> model) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nLines = c296;
+            constexpr int32_t nPixels = c297;
+            return (([&]() -> juniper::unit {
+                NeoPixel::Action guid297 = action;
+                return (((bool) (((bool) ((guid297).id() == ((uint8_t) 1))) && true)) ? 
+                    (([&]() -> juniper::unit {
+                        NeoPixel::Function fn = ((guid297).run()).e2;
+                        uint8_t line = ((guid297).run()).e1;
+                        return (([&]() -> juniper::unit {
+                            (([&]() -> juniper::unit {
+                                 Recorder::staged(action); 
+                                return {};
+                            })());
+                            return stageFunction<t5001, c297>(((((model).get())->lines).data)[line], fn);
+                        })());
+                    })())
+                :
+                    (((bool) (((bool) ((guid297).id() == ((uint8_t) 2))) && true)) ? 
+                        (([&]() -> juniper::unit {
+                            Prelude::maybe<uint8_t> endAfter = ((guid297).repeat()).e4;
+                            uint32_t interval = ((guid297).repeat()).e3;
+                            NeoPixel::Function fn = ((guid297).repeat()).e2;
+                            uint8_t line = ((guid297).repeat()).e1;
+                            return (([&]() -> juniper::unit {
                                 (([&]() -> juniper::unit {
-                                     Serial.println("Rotate"); 
+                                     Recorder::staged(action); 
                                     return {};
                                 })());
-                                return ListExt::rotated<NeoPixel::color, c260>(cast<int16_t, int32_t>(step), pixels);
+                                stageFunction<t5001, c297>(((((model).get())->lines).data)[line], fn);
+                                return startOperation<t5001, c296, c297>(model, line, fn, interval, endAfter, nextDue(Time::now(), interval));
                             })());
                         })())
                     :
-                        (((bool) (((bool) ((guid257).id() == ((uint8_t) 1))) && true)) ? 
-                            (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-                                NeoPixel::color color = (guid257).set();
-                                return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
+                        (((bool) (((bool) ((guid297).id() == ((uint8_t) 4))) && true)) ? 
+                            (([&]() -> juniper::unit {
+                                uint8_t level = ((guid297).brightness()).e2;
+                                uint8_t line = ((guid297).brightness()).e1;
+                                return (([&]() -> juniper::unit {
                                     (([&]() -> juniper::unit {
-                                         Serial.println("Set color"); 
+                                         Recorder::staged(action); 
                                         return {};
                                     })());
-                                    return List::map<NeoPixel::color, juniper::closures::closuret_8<NeoPixel::color>, NeoPixel::color, c260>(juniper::function<juniper::closures::closuret_8<NeoPixel::color>, NeoPixel::color(NeoPixel::color)>(juniper::closures::closuret_8<NeoPixel::color>(color), [](juniper::closures::closuret_8<NeoPixel::color>& junclosure, NeoPixel::color _) -> NeoPixel::color { 
-                                        NeoPixel::color& color = junclosure.color;
-                                        return color;
-                                     }), pixels);
+                                    (((((((model).get())->lines).data)[line]).get())->brightness = level);
+                                    return refreshLevels<t5001, c297>(((((model).get())->lines).data)[line]);
                                 })());
                             })())
                         :
-                            (((bool) (((bool) ((guid257).id() == ((uint8_t) 2))) && true)) ? 
-                                (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
-                                    NeoPixel::color c2 = ((guid257).alternate()).e2;
-                                    NeoPixel::color c1 = ((guid257).alternate()).e1;
-                                    return (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t> {
+                            (((bool) (((bool) ((guid297).id() == ((uint8_t) 5))) && true)) ? 
+                                (([&]() -> juniper::unit {
+                                    bool enabled = ((guid297).gammaCorrect()).e2;
+                                    uint8_t line = ((guid297).gammaCorrect()).e1;
+                                    return (([&]() -> juniper::unit {
                                         (([&]() -> juniper::unit {
-                                             Serial.println("Alternate"); 
+                                             Recorder::staged(action); 
                                             return {};
                                         })());
-                                        return ListExt::replicateList<NeoPixel::color, c260, 2>(cast<int32_t, uint32_t>(nPixels), (([&]() -> juniper::records::recordt_0<juniper::array<NeoPixel::color, 2>, uint32_t>{
-                                            juniper::records::recordt_0<juniper::array<NeoPixel::color, 2>, uint32_t> guid258;
-                                            guid258.data = (juniper::array<NeoPixel::color, 2> { {c1, c2} });
-                                            guid258.length = ((uint32_t) 2);
-                                            return guid258;
-                                        })()));
+                                        (((((((model).get())->lines).data)[line]).get())->gammaCorrect = enabled);
+                                        return refreshLevels<t5001, c297>(((((model).get())->lines).data)[line]);
                                     })());
                                 })())
                             :
-                                juniper::quit<juniper::records::recordt_0<juniper::array<NeoPixel::color, c260>, uint32_t>>())));
-                })());
+                                (((bool) (((bool) ((guid297).id() == ((uint8_t) 6))) && true)) ? 
+                                    (([&]() -> juniper::unit {
+                                        uint32_t c = ((guid297).paletteColor()).e2;
+                                        uint8_t index = ((guid297).paletteColor()).e1;
+                                        return (([&]() -> juniper::unit {
+                                            (([&]() -> juniper::unit {
+                                                 Recorder::staged(action); 
+                                                return {};
+                                            })());
+                                            (([&]() -> juniper::unit {
+                                                 Palette::set(index, c); 
+                                                return {};
+                                            })());
+                                            return refreshPalette<t5001, c296, c297>(model);
+                                        })());
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid297).id() == ((uint8_t) 7))) && true)) ? 
+                                        (([&]() -> juniper::unit {
+                                            int16_t step = (guid297).rotatePalette();
+                                            return (([&]() -> juniper::unit {
+                                                (([&]() -> juniper::unit {
+                                                     Recorder::staged(action); 
+                                                    return {};
+                                                })());
+                                                (([&]() -> juniper::unit {
+                                                     Palette::rotate(step); 
+                                                    return {};
+                                                })());
+                                                return refreshPalette<t5001, c296, c297>(model);
+                                            })());
+                                        })())
+                                    :
+                                        (((bool) (((bool) ((guid297).id() == ((uint8_t) 8))) && true)) ? 
+                                            (([&]() -> juniper::unit {
+                                                uint8_t slot = ((guid297).matrix()).e2;
+                                                uint8_t line = ((guid297).matrix()).e1;
+                                                return (([&]() -> juniper::unit {
+                                                    (([&]() -> juniper::unit {
+                                                         Recorder::staged(action); 
+                                                        return {};
+                                                    })());
+                                                    flushLine<t5001, c297>(((((model).get())->lines).data)[line]);
+                                                    (((((((model).get())->lines).data)[line]).get())->matrix = slot);
+                                                    return juniper::unit();
+                                                })());
+                                            })())
+                                        :
+                                            (true ? 
+                                                (([&]() -> juniper::unit {
+                                                    return update<t5001, c296, c297>(just<NeoPixel::Action>(action), model);
+                                                })())
+                                            :
+                                                juniper::quit<juniper::unit>()))))))));
             })());
         })());
     }
 }
 
 namespace NeoPixel {
-    template<int c265>
-    juniper::records::recordt_0<juniper::array<Prelude::maybe<NeoPixel::color>, c265>, uint32_t> diffPixels(juniper::records::recordt_0<juniper::array<NeoPixel::color, c265>, uint32_t> current, juniper::records::recordt_0<juniper::array<NeoPixel::color, c265>, uint32_t> next) {
-        return (([&]() -> juniper::records::recordt_0<juniper::array<Prelude::maybe<NeoPixel::color>, c265>, uint32_t> {
-            constexpr int32_t nPixels = c265;
-            return (([&]() -> juniper::records::recordt_0<juniper::array<Prelude::maybe<NeoPixel::color>, c265>, uint32_t> {
-                return List::map<Prelude::maybe<NeoPixel::color>, void, juniper::tuple2<NeoPixel::color, NeoPixel::color>, c265>(juniper::function<void, Prelude::maybe<NeoPixel::color>(juniper::tuple2<NeoPixel::color, NeoPixel::color>)>([](juniper::tuple2<NeoPixel::color, NeoPixel::color> tup) -> Prelude::maybe<NeoPixel::color> { 
-                    return (([&]() -> Prelude::maybe<NeoPixel::color> {
-                        juniper::tuple2<NeoPixel::color, NeoPixel::color> guid259 = tup;
-                        if (!(true)) {
-                            juniper::quit<juniper::unit>();
-                        }
-                        NeoPixel::color next = (guid259).e2;
-                        NeoPixel::color curr = (guid259).e1;
-                        
-                        return (eq<NeoPixel::color>(curr, next) ? 
-                            nothing<NeoPixel::color>()
-                        :
-                            just<NeoPixel::color>(next));
-                    })());
-                 }), List::zip<NeoPixel::color, NeoPixel::color, c265>(current, next));
+    uint32_t RGB(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t) (((uint32_t) (((uint32_t) (toUInt32<uint8_t>(r) << ((uint32_t) 16))) | ((uint32_t) (toUInt32<uint8_t>(g) << ((uint32_t) 8))))) | toUInt32<uint8_t>(b)));
+    }
+}
+
+namespace NeoPixel {
+    uint32_t HSV(uint16_t hue, uint8_t saturation, uint8_t value) {
+        return (([&]() -> uint32_t {
+            uint32_t c;
+            
+            (([&]() -> juniper::unit {
+                 c = Kernels::hsvToRgb(hue, saturation, value); 
+                return {};
             })());
+            return c;
         })());
     }
 }
 
 namespace NeoPixel {
-    juniper::unit setPixelColor(uint16_t n, NeoPixel::color color, NeoPixel::RawDevice line) {
-        return (([&]() -> juniper::unit {
-            NeoPixel::RawDevice guid260 = line;
-            if (!(((bool) (((bool) ((guid260).id() == ((uint8_t) 0))) && true)))) {
-                juniper::quit<juniper::unit>();
-            }
-            void * p = (guid260).device();
-            
-            NeoPixel::color guid261 = color;
-            if (!(((bool) (((bool) ((guid261).id() == ((uint8_t) 0))) && true)))) {
-                juniper::quit<juniper::unit>();
-            }
-            uint8_t b = ((guid261).RGB()).e3;
-            uint8_t g = ((guid261).RGB()).e2;
-            uint8_t r = ((guid261).RGB()).e1;
+    template<int c301>
+    bool loadEffect(uint8_t slot, juniper::records::recordt_0<juniper::array<uint8_t, c301>, uint32_t> code) {
+        return (([&]() -> bool {
+            constexpr int32_t n = c301;
+            return (([&]() -> bool {
+                bool loaded;
+                
+                (([&]() -> juniper::unit {
+                     loaded = Effects::load(slot, &code.data[0], code.length); 
+                    return {};
+                })());
+                return loaded;
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    bool loadMatrix(uint8_t slot, uint16_t width, uint16_t height, uint8_t order, uint8_t tilesAcross, uint8_t tilesDown, uint8_t tileOrder) {
+        return (([&]() -> bool {
+            bool loaded;
             
-            return (([&]() -> juniper::unit {
-                 ((Adafruit_NeoPixel*) p)->setPixelColor(n, r, g, b); 
+            (([&]() -> juniper::unit {
+                 loaded = Matrix::load(slot, width, height, order, tilesAcross, tilesDown, tileOrder); 
                 return {};
             })());
+            return loaded;
         })());
     }
 }
 
 namespace NeoPixel {
-    juniper::unit show(NeoPixel::RawDevice line) {
-        return (([&]() -> juniper::unit {
-            NeoPixel::RawDevice guid262 = line;
-            if (!(((bool) (((bool) ((guid262).id() == ((uint8_t) 0))) && true)))) {
+    uint32_t getPixelColor(uint16_t n, NeoPixel::RawDevice line) {
+        return (([&]() -> uint32_t {
+            NeoPixel::RawDevice guid241 = line;
+            if (!(((bool) (((bool) ((guid241).id() == ((uint8_t) 0))) && true)))) {
                 juniper::quit<juniper::unit>();
             }
-            void * p = (guid262).device();
+            void * p = (guid241).device();
             
-            return (([&]() -> juniper::unit {
-                 ((Adafruit_NeoPixel*) p)->show(); 
+            uint32_t guid242 = ((uint32_t) 0);
+            if (!(true)) {
+                juniper::quit<juniper::unit>();
+            }
+            uint32_t numRep = guid242;
+            
+            (([&]() -> juniper::unit {
+                 numRep = ((Adafruit_NeoPixel*) p)->getPixelColor(n); 
                 return {};
             })());
+            return numRep;
         })());
     }
 }
 
 namespace NeoPixel {
-    template<int c268>
-    juniper::unit writePixels(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>> line) {
+    template<typename t5002, int c253>
+    juniper::unit readPixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5002, c253>, uint32_t>, juniper::records::recordt_0<juniper::array<t5002, c253>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
         return (([&]() -> juniper::unit {
-            constexpr int32_t n = c268;
+            constexpr int32_t n = c253;
             return (([&]() -> juniper::unit {
-                List::iter<juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>>>, juniper::tuple2<uint32_t, Prelude::maybe<NeoPixel::color>>, c268>(juniper::function<juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>>>, juniper::unit(juniper::tuple2<uint32_t, Prelude::maybe<NeoPixel::color>>)>(juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>>>(line), [](juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>>>& junclosure, juniper::tuple2<uint32_t, Prelude::maybe<NeoPixel::color>> tup) -> juniper::unit { 
-                    juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c268>, uint32_t>>>& line = junclosure.line;
+            Prelude::maybe<NeoPixel::RawDevice> guid245 = ((line).get())->device;
+            return (((bool) (((bool) ((guid245).id() == ((uint8_t) 0))) && ((bool) (((bool) (((guid245).just()).id() == ((uint8_t) 0))) && true)))) ? 
+                (([&]() -> juniper::unit {
+                    void * p = ((guid245).just()).device();
                     return (([&]() -> juniper::unit {
-                        juniper::tuple2<uint32_t, Prelude::maybe<NeoPixel::color>> guid263 = tup;
-                        if (!(true)) {
-                            juniper::quit<juniper::unit>();
-                        }
-                        Prelude::maybe<NeoPixel::color> color = (guid263).e2;
-                        uint32_t index = (guid263).e1;
-                        
-                        return (([&]() -> juniper::unit {
-                            Prelude::maybe<NeoPixel::color> guid264 = color;
-                            return (((bool) (((bool) ((guid264).id() == ((uint8_t) 0))) && true)) ? 
-                                (([&]() -> juniper::unit {
-                                    NeoPixel::color pixel = (guid264).just();
+                        (([&]() -> juniper::unit {
+                             Kernels::readPixels((Adafruit_NeoPixel*) p, &line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length); 
+                            return {};
+                        })());
+                        (([&]() -> juniper::unit {
+                             Kernels::copyPixels(&line.get()->arena.get()->previousPixels.data[line.get()->start], &line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length); 
+                            return {};
+                        })());
+                        return (([&]() -> juniper::unit {
+                             Kernels::writeGRB((Adafruit_NeoPixel*) p, 0, &line.get()->arena.get()->previousPixels.data[line.get()->start], line.get()->length, &line.get()->levels.data[0], Palette::colors()); 
+                            return {};
+                        })());
+                    })());
+                })())
+            :
+                (((bool) (((bool) ((guid245).id() == ((uint8_t) 1))) && true)) ? 
+                    (([&]() -> juniper::unit {
+                        return juniper::unit();
+                    })())
+                :
+                    juniper::quit<juniper::unit>()));
+
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5003, int c256, int c257>
+    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>> initialState(juniper::array<juniper::records::recordt_7<uint16_t, uint16_t>, c257> descriptors) {
+        return (([&]() -> juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>> {
+            constexpr int32_t nPixels = c256;
+            constexpr int32_t nLines = c257;
+            return (([&]() -> juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>> {
+                juniper::array<t5003, c256> guid312 = zeros<t5003, c256>();
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::array<t5003, c256> blank = guid312;
+                
+                juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>> guid313 = (juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>((([&]() -> juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>{
+                    juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>> guid314;
+                    guid314.pixels = (([&]() -> juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>{
+                        juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t> guid315;
+                        guid315.data = blank;
+                        guid315.length = cast<int32_t, uint32_t>(nPixels);
+                        return guid315;
+                    })());
+                    guid314.previousPixels = (([&]() -> juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>{
+                        juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t> guid316;
+                        guid316.data = blank;
+                        guid316.length = cast<int32_t, uint32_t>(nPixels);
+                        return guid316;
+                    })());
+                    return guid314;
+                })())));
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>> arena = guid313;
+                
+                juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t> guid317 = List::map<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, juniper::closures::closuret_7<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>>, juniper::records::recordt_7<uint16_t, uint16_t>, c257>(juniper::function<juniper::closures::closuret_7<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>>, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>(juniper::records::recordt_7<uint16_t, uint16_t>)>(juniper::closures::closuret_7<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>>(arena), [](juniper::closures::closuret_7<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>>& junclosure, juniper::records::recordt_7<uint16_t, uint16_t> descriptor) -> juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> { 
+                    juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>& arena = junclosure.arena;
+                    return (juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>((([&]() -> juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>{
+                        juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool> guid252;
+                        guid252.arena = arena;
+                        guid252.clean = true;
+                        guid252.start = ((uint32_t) 0);
+                        guid252.length = cast<uint16_t, uint32_t>((descriptor).length);
+                        guid252.offset = ((uint32_t) 0);
+                        guid252.operation = nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>();
+                        guid252.painted = nothing<NeoPixel::Function>();
+                        guid252.pending = nothing<NeoPixel::Function>();
+                        guid252.deferred = false;
+                        guid252.unsent = false;
+                        guid252.fade = nothing<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>();
+                        guid252.frames = makeFrames();
+                        guid252.pin = (descriptor).pin;
+                        guid252.device = just<NeoPixel::RawDevice>(makeDevice((descriptor).pin, (descriptor).length));
+                        guid252.brightness = ((uint8_t) 255);
+                        guid252.gammaCorrect = false;
+                        guid252.levels = makeLevels(((uint8_t) 255), false);
+                        guid252.matrix = ((uint8_t) 255);
+                        return guid252;
+                    })())));
+                 }), (([&]() -> juniper::records::recordt_0<juniper::array<juniper::records::recordt_7<uint16_t, uint16_t>, c257>, uint32_t>{
+                    juniper::records::recordt_0<juniper::array<juniper::records::recordt_7<uint16_t, uint16_t>, c257>, uint32_t> guid253;
+                    guid253.data = descriptors;
+                    guid253.length = cast<int32_t, uint32_t>(nLines);
+                    return guid253;
+                })()));
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t> lines = guid317;
+                
+                uint32_t guid318 = ((uint32_t) 0);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t start = guid318;
+                
+                (([&]() -> juniper::unit {
+                    uint32_t guid319 = ((uint32_t) 0);
+                    uint32_t guid320 = (lines).length;
+                    for (uint32_t i = guid319; i < guid320; i++) {
+                        (([&]() -> juniper::unit {
+                            juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> guid321 = ((lines).data)[i];
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line = guid321;
+                            
+                            (((line).get())->start = start);
+                            (((line).get())->length = Math::min_<uint32_t>(((line).get())->length, ((uint32_t) (cast<int32_t, uint32_t>(nPixels) - start))));
+                            (start += ((line).get())->length);
+                            return readPixels<t5003, c256>(line);
+                        })());
+                    }
+                    return {};
+                })());
+                return (juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>>((([&]() -> juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>>{
+                    juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>, juniper::records::recordt_0<juniper::array<t5003, c256>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c257>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c257>, uint32_t>> guid249;
+                    guid249.lines = lines;
+                    guid249.schedule = List::empty<juniper::records::recordt_12<uint8_t, uint32_t>, c257>();
+                    return guid249;
+                })())));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    NeoPixel::RawDevice makeDevice(uint16_t pin, uint16_t pixels) {
+        return (([&]() -> NeoPixel::RawDevice {
+            void * ret;
+            
+            (([&]() -> juniper::unit {
+                 ret = new Adafruit_NeoPixel(pixels, pin, NEO_GRB + NEO_KHZ800); 
+                return {};
+            })());
+            return NeoPixel::device(ret);
+        })());
+    }
+}
+
+namespace NeoPixel {
+    void * makeFrames() {
+        return (([&]() -> void * {
+            void * ret;
+            
+            (([&]() -> juniper::unit {
+                 ret = new Frames::Cache(); 
+                return {};
+            })());
+            return ret;
+        })());
+    }
+}
+
+namespace NeoPixel {
+    juniper::unit watchClock(uint32_t now) {
+        return (([&]() -> juniper::unit {
+            (scheduleEpoch = ((uint32_t) (now - ((uint32_t) 2147483648))));
+            return juniper::unit();
+        })());
+    }
+}
+
+namespace NeoPixel {
+    bool reached(uint32_t time, uint32_t now) {
+        return (([&]() -> bool {
+            int32_t guid333 = cast<uint32_t, int32_t>(((uint32_t) (time - now)));
+            if (!(true)) {
+                juniper::quit<juniper::unit>();
+            }
+            int32_t ahead = guid333;
+            
+            return ((bool) (ahead <= ((int32_t) 0)));
+        })());
+    }
+}
+
+namespace NeoPixel {
+    uint32_t nextDue(uint32_t last, uint32_t interval) {
+        return (((bool) (interval == ((uint32_t) 0))) ? 
+            (([&]() -> uint32_t {
+                return ((uint32_t) (last + ((uint32_t) 1)));
+            })())
+        :
+            (([&]() -> uint32_t {
+                return ((uint32_t) (((uint32_t) (((uint32_t) (last / interval)) + ((uint32_t) 1))) * interval));
+            })()));
+    }
+}
+
+namespace NeoPixel {
+    uint32_t urgency(juniper::records::recordt_12<uint8_t, uint32_t> due) {
+        return ((uint32_t) (((uint32_t) 4294967295) - ((uint32_t) ((due).time - scheduleEpoch))));
+    }
+}
+
+namespace NeoPixel {
+    template<int c287>
+    juniper::unit siftUp(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c287>, uint32_t>& schedule, uint32_t i) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c287;
+            return (([&]() -> juniper::unit {
+                uint32_t guid284 = i;
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t child = guid284;
+                
+                return (([&]() -> juniper::unit {
+                    while (((bool) (((bool) (child > ((uint32_t) 0))) && ((bool) (urgency(((schedule).data)[List::iParent(child)]) < urgency(((schedule).data)[child])))))) {
+                        (([&]() -> juniper::unit {
+                            uint32_t guid285 = List::iParent(child);
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            uint32_t parent = guid285;
+                            
+                            juniper::records::recordt_12<uint8_t, uint32_t> guid286 = ((schedule).data)[parent];
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            juniper::records::recordt_12<uint8_t, uint32_t> tmp = guid286;
+                            
+                            (((schedule).data)[parent] = ((schedule).data)[child]);
+                            (((schedule).data)[child] = tmp);
+                            (child = parent);
+                            return juniper::unit();
+                        })());
+                    }
+                    return {};
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<int c288>
+    uint32_t findDue(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c288>, uint32_t> schedule, uint8_t line) {
+        return (([&]() -> uint32_t {
+            constexpr int32_t n = c288;
+            return (([&]() -> uint32_t {
+                uint32_t guid287 = ((uint32_t) 0);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t i = guid287;
+                
+                (([&]() -> juniper::unit {
+                    while (((bool) (((bool) (i < (schedule).length)) && ((bool) ((((schedule).data)[i]).line != line))))) {
+                        (([&]() -> uint32_t {
+                            return (i += ((uint32_t) 1));
+                        })());
+                    }
+                    return {};
+                })());
+                return i;
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<int c289>
+    juniper::unit removeDue(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c289>, uint32_t>& schedule, uint32_t i) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c289;
+            return (([&]() -> juniper::unit {
+                ((schedule).length -= ((uint32_t) 1));
+                return (([&]() -> juniper::unit {
+                    if (((bool) (i < (schedule).length))) {
+                        (([&]() -> juniper::unit {
+                            (((schedule).data)[i] = ((schedule).data)[(schedule).length]);
+                            List::siftDown<uint32_t, uint32_t, void, juniper::records::recordt_12<uint8_t, uint32_t>, c289>(schedule, juniper::function<void, uint32_t(juniper::records::recordt_12<uint8_t, uint32_t>)>(urgency), i, (schedule).length);
+                            return siftUp<c289>(schedule, i);
+                        })());
+                    }
+                    return {};
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<int c290>
+    juniper::unit scheduleLine(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c290>, uint32_t>& schedule, uint8_t line, uint32_t time) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c290;
+            return (([&]() -> juniper::unit {
+                uint32_t guid288 = findDue<c290>(schedule, line);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t i = guid288;
+                
+                (([&]() -> juniper::unit {
+                    if (((bool) (i == (schedule).length))) {
+                        (([&]() -> uint32_t {
+                            return ((schedule).length += ((uint32_t) 1));
+                        })());
+                    }
+                    return {};
+                })());
+                (((schedule).data)[i] = (([&]() -> juniper::records::recordt_12<uint8_t, uint32_t>{
+                    juniper::records::recordt_12<uint8_t, uint32_t> guid289;
+                    guid289.line = line;
+                    guid289.time = time;
+                    return guid289;
+                })()));
+                List::siftDown<uint32_t, uint32_t, void, juniper::records::recordt_12<uint8_t, uint32_t>, c290>(schedule, juniper::function<void, uint32_t(juniper::records::recordt_12<uint8_t, uint32_t>)>(urgency), i, (schedule).length);
+                return siftUp<c290>(schedule, i);
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<int c291>
+    juniper::unit unscheduleLine(juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c291>, uint32_t>& schedule, uint8_t line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c291;
+            return (([&]() -> juniper::unit {
+                uint32_t guid290 = findDue<c291>(schedule, line);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t i = guid290;
+                
+                return (([&]() -> juniper::unit {
+                    if (((bool) (i < (schedule).length))) {
+                        (([&]() -> juniper::unit {
+                            return removeDue<c291>(schedule, i);
+                        })());
+                    }
+                    return {};
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5004, int c298, int c299>
+    juniper::unit startOperation(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5004, c299>, uint32_t>, juniper::records::recordt_0<juniper::array<t5004, c299>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c298>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c298>, uint32_t>>> model, uint8_t line, NeoPixel::Function fn, uint32_t interval, Prelude::maybe<uint8_t> endAfter, uint32_t first) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nLines = c298;
+            constexpr int32_t nPixels = c299;
+            return (([&]() -> juniper::unit {
+                (((((((model).get())->lines).data)[line]).get())->operation = just<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>((([&]() -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>{
+                    juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t> guid298;
+                    guid298.function = fn;
+                    guid298.interval = interval;
+                    guid298.endAfter = endAfter;
+                    return guid298;
+                })())));
+                watchClock(Time::now());
+                return scheduleLine<c298>(((model).get())->schedule, line, first);
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5005, int c292, int c293>
+    juniper::unit runDue(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>, juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c292>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c292>, uint32_t>>> model) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nLines = c292;
+            constexpr int32_t nPixels = c293;
+            return (([&]() -> juniper::unit {
+                uint32_t guid291 = Time::now();
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t now = guid291;
+                
+                watchClock(now);
+                uint32_t guid334 = (((model).get())->schedule).length;
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t left = guid334;
+                
+                return (([&]() -> juniper::unit {
+                    while (((bool) (((bool) (((bool) (left > ((uint32_t) 0))) && ((bool) ((((model).get())->schedule).length > ((uint32_t) 0))))) && reached((((((model).get())->schedule).data)[((uint32_t) 0)]).time, now)))) {
+                        (([&]() -> juniper::unit {
+                            (left -= ((uint32_t) 1));
+                            juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>, juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> guid292 = ((((model).get())->lines).data)[(((((model).get())->schedule).data)[((uint32_t) 0)]).line];
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>, juniper::records::recordt_0<juniper::array<t5005, c293>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line = guid292;
+                            
+                            (((line).get())->operation = updateOperation(((line).get())->operation));
+                            return (([&]() -> juniper::unit {
+                                Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> guid293 = ((line).get())->operation;
+                                return (((bool) (((bool) ((guid293).id() == ((uint8_t) 0))) && true)) ? 
+                                    (([&]() -> juniper::unit {
+                                        juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t> op = (guid293).just();
+                                        return (([&]() -> juniper::unit {
+                                            stageFunction<t5005, c293>(line, (op).function);
+                                            ((((((model).get())->schedule).data)[((uint32_t) 0)]).time = nextDue(now, (op).interval));
+                                            return List::siftDown<uint32_t, uint32_t, void, juniper::records::recordt_12<uint8_t, uint32_t>, c292>(((model).get())->schedule, juniper::function<void, uint32_t(juniper::records::recordt_12<uint8_t, uint32_t>)>(urgency), ((uint32_t) 0), (((model).get())->schedule).length);
+                                        })());
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid293).id() == ((uint8_t) 1))) && true)) ? 
+                                        (([&]() -> juniper::unit {
+                                            return removeDue<c292>(((model).get())->schedule, ((uint32_t) 0));
+                                        })())
+                                    :
+                                        juniper::quit<juniper::unit>()));
+                            })());
+                        })());
+                    }
+                    return {};
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> updateOperation(Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> operation) {
+        return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+            (([&]() -> juniper::unit {
+                 Serial.println("updateOperation"); 
+                return {};
+            })());
+            return MaybeExt::flatMap<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>, void, juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>(juniper::function<void, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>(juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>)>([](juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t> op) -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> { 
+                return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                    return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                        Prelude::maybe<uint8_t> guid255 = (op).endAfter;
+                        return (((bool) (((bool) ((guid255).id() == ((uint8_t) 0))) && ((bool) (((bool) ((guid255).just() == ((uint8_t) 0))) && true)))) ? 
+                            (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                                return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                                    return nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>();
+                                })());
+                            })())
+                        :
+                            (true ? 
+                                (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                                    return (([&]() -> Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>> {
+                                        return just<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>((([&]() -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>{
+                                            juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t> guid256;
+                                            guid256.function = (op).function;
+                                            guid256.interval = (op).interval;
+                                            guid256.endAfter = Maybe::map<uint8_t, void, uint8_t>(juniper::function<void, uint8_t(uint8_t)>([](uint8_t n) -> uint8_t { 
+                                                return (([&]() -> uint8_t {
+                                                    return Math::max_<uint8_t>(((uint8_t) 0), ((uint8_t) (n - ((uint8_t) 1))));
+                                                })());
+                                             }), (op).endAfter);
+                                            return guid256;
+                                        })()));
+                                    })());
+                                })())
+                            :
+                                juniper::quit<Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>>()));
+                    })());
+                })());
+             }), operation);
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5023, int c308>
+    bool leavesPixels(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5023, c308>, uint32_t>, juniper::records::recordt_0<juniper::array<t5023, c308>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> bool {
+            constexpr int32_t nPixels = c308;
+            return (([&]() -> bool {
+                NeoPixel::Function guid329 = fn;
+                return (((bool) (((bool) ((guid329).id() == ((uint8_t) 0))) && true)) ? 
+                    (([&]() -> bool {
+                        int16_t step = (guid329).rotate();
+                        return (([&]() -> bool {
+                            int32_t guid330 = cast<uint32_t, int32_t>(((line).get())->length);
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            int32_t length = guid330;
+                            
+                            bool guid331 = (([&]() -> bool {
+                                Prelude::maybe<NeoPixel::Function> guid332 = ((line).get())->painted;
+                                return (((bool) (((bool) ((guid332).id() == ((uint8_t) 0))) && ((bool) (((bool) (((guid332).just()).id() == ((uint8_t) 1))) && true)))) ? 
+                                    (([&]() -> bool {
+                                        return true;
+                                    })())
+                                :
+                                    (true ? 
+                                        (([&]() -> bool {
+                                            return false;
+                                        })())
+                                    :
+                                        juniper::quit<bool>()));
+                            })());
+                            if (!(true)) {
+                                juniper::quit<juniper::unit>();
+                            }
+                            bool uniform = guid331;
+                            
+                            return ((bool) (((bool) (((bool) (length == ((int32_t) 0))) || ((bool) (((int32_t) (cast<int16_t, int32_t>(step) % length)) == ((int32_t) 0))))) || uniform));
+                        })());
+                    })())
+                :
+                    (((bool) (((bool) ((guid329).id() == ((uint8_t) 1))) && true)) ? 
+                        (([&]() -> bool {
+                            return ((bool) (((line).get())->painted == just<NeoPixel::Function>(fn)));
+                        })())
+                    :
+                        (((bool) (((bool) ((guid329).id() == ((uint8_t) 2))) && true)) ? 
+                            (([&]() -> bool {
+                                return ((bool) (((bool) (((line).get())->painted == just<NeoPixel::Function>(fn))) && ((bool) (((line).get())->offset == ((uint32_t) 0)))));
+                            })())
+                        :
+                            (((bool) (((bool) ((guid329).id() == ((uint8_t) 5))) && true)) ? 
+                                (([&]() -> bool {
+                                    return ((bool) (((bool) (((line).get())->painted == just<NeoPixel::Function>(fn))) && ((bool) (((line).get())->offset == ((uint32_t) 0)))));
+                                })())
+                            :
+                                (((bool) (((bool) ((guid329).id() == ((uint8_t) 6))) && true)) ? 
+                                    (([&]() -> bool {
+                                        return ((bool) (((bool) (((line).get())->painted == just<NeoPixel::Function>(fn))) && ((bool) (((line).get())->offset == ((uint32_t) 0)))));
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid329).id() == ((uint8_t) 3))) && true)) ? 
+                                        (([&]() -> bool {
+                                            return false;
+                                        })())
+                                    :
+                                        (((bool) (((bool) ((guid329).id() == ((uint8_t) 4))) && true)) ? 
+                                            (([&]() -> bool {
+                                                return false;
+                                            })())
+                                        :
+                                            (((bool) (((bool) ((guid329).id() == ((uint8_t) 7))) && true)) ? 
+                                                (([&]() -> bool {
+                                                    uint8_t slot = (guid329).stream();
+                                                    return (([&]() -> bool {
+                                                        bool idle;
+                                                        
+                                                        (([&]() -> juniper::unit {
+                                                             idle = Streams::idle(slot); 
+                                                            return {};
+                                                        })());
+                                                        return ((bool) (idle || !(((line).get())->clean)));
+                                                    })());
+                                                })())
+                                            :
+                                                juniper::quit<bool>()))))))));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5006, int c260>
+    juniper::unit applyFunction(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5006, c260>, uint32_t>, juniper::records::recordt_0<juniper::array<t5006, c260>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nPixels = c260;
+            return (([&]() -> juniper::unit {
+                if (!(leavesPixels<t5006, c260>(fn, line))) {
+                    (([&]() -> juniper::unit {
+                        (((line).get())->clean = false);
+                        return paintLine<t5006, c260>(fn, line);
+                    })());
+                }
+                return {};
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5022, int c307>
+    juniper::unit paintLine(NeoPixel::Function fn, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5022, c307>, uint32_t>, juniper::records::recordt_0<juniper::array<t5022, c307>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nPixels = c307;
+            return (([&]() -> juniper::unit {
+                (([&]() -> juniper::unit {
+                    NeoPixel::Function guid257 = fn;
+                    return (((bool) (((bool) ((guid257).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> juniper::unit {
+                            int16_t step = (guid257).rotate();
+                            return (([&]() -> juniper::unit {
+                                (([&]() -> juniper::unit {
+                                     Serial.println("Rotate"); 
+                                    return {};
+                                })());
+                                return (([&]() -> juniper::unit {
+                                    if (((bool) (((line).get())->length > ((uint32_t) 0)))) {
+                                        (([&]() -> juniper::unit {
+                                            int32_t guid258 = cast<uint32_t, int32_t>(((line).get())->length);
+                                            if (!(true)) {
+                                                juniper::quit<juniper::unit>();
+                                            }
+                                            int32_t length = guid258;
+                                            
+                                            int32_t guid259 = ((int32_t) (((int32_t) (((int32_t) (cast<int16_t, int32_t>(step) % length)) + length)) % length));
+                                            if (!(true)) {
+                                                juniper::quit<juniper::unit>();
+                                            }
+                                            int32_t normalizedStep = guid259;
+                                            
+                                            (((line).get())->offset = ((uint32_t) (((uint32_t) (((line).get())->offset + cast<int32_t, uint32_t>(normalizedStep))) % ((line).get())->length)));
+                                            return juniper::unit();
+                                        })());
+                                    }
+                                    return {};
+                                })());
+                            })());
+                        })())
+                    :
+                        (((bool) (((bool) ((guid257).id() == ((uint8_t) 1))) && true)) ? 
+                            (([&]() -> juniper::unit {
+                                uint32_t color = (guid257).set();
+                                return (([&]() -> juniper::unit {
+                                    (([&]() -> juniper::unit {
+                                         Serial.println("Set color"); 
+                                        return {};
+                                    })());
+                                    (([&]() -> juniper::unit {
+                                        if (((bool) (((line).get())->painted != just<NeoPixel::Function>(fn)))) {
+                                            (([&]() -> juniper::unit {
+                                                 Kernels::fillPattern(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, color, color); 
+                                                return {};
+                                            })());
+                                        }
+                                        return {};
+                                    })());
+                                    (((line).get())->offset = ((uint32_t) 0));
+                                    return juniper::unit();
+                                })());
+                            })())
+                        :
+                            (((bool) (((bool) ((guid257).id() == ((uint8_t) 2))) && true)) ? 
+                                (([&]() -> juniper::unit {
+                                    uint32_t c2 = ((guid257).alternate()).e2;
+                                    uint32_t c1 = ((guid257).alternate()).e1;
+                                    return (([&]() -> juniper::unit {
+                                        (([&]() -> juniper::unit {
+                                             Serial.println("Alternate"); 
+                                            return {};
+                                        })());
+                                        (([&]() -> juniper::unit {
+                                            if (((bool) (((line).get())->painted != just<NeoPixel::Function>(fn)))) {
+                                                (([&]() -> juniper::unit {
+                                                     Kernels::fillPattern(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, c1, c2); 
+                                                    return {};
+                                                })());
+                                            }
+                                            return {};
+                                        })());
+                                        (((line).get())->offset = ((uint32_t) 0));
+                                        return juniper::unit();
+                                    })());
+                                })())
+                            :
+                                (((bool) (((bool) ((guid257).id() == ((uint8_t) 3))) && true)) ? 
+                                    (([&]() -> juniper::unit {
+                                        uint8_t slot = (guid257).effect();
+                                        return (([&]() -> juniper::unit {
+                                            (([&]() -> juniper::unit {
+                                                 Serial.println("Effect"); 
+                                                return {};
+                                            })());
+                                            uint32_t guid304 = Time::now();
+                                            if (!(true)) {
+                                                juniper::quit<juniper::unit>();
+                                            }
+                                            uint32_t now = guid304;
+                                            
+                                            return (([&]() -> juniper::unit {
+                                                 Effects::run(slot, &line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, line.get()->offset, now, Matrix::find(line.get()->matrix, line.get()->length)); 
+                                                return {};
+                                            })());
+                                        })());
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid257).id() == ((uint8_t) 4))) && true)) ? 
+                                        (([&]() -> juniper::unit {
+                                            uint32_t target = ((guid257).fade()).e1;
+                                            uint32_t duration = ((guid257).fade()).e2;
+                                            return (([&]() -> juniper::unit {
+                                                (([&]() -> juniper::unit {
+                                                     Serial.println("Fade"); 
+                                                    return {};
+                                                })());
+                                                return stepFade<t5022, c307>(line, target, duration);
+                                            })());
+                                        })())
+                                    :
+                                        (((bool) (((bool) ((guid257).id() == ((uint8_t) 5))) && true)) ? 
+                                            (([&]() -> juniper::unit {
+                                                uint32_t first = ((guid257).gradient()).e1;
+                                                uint32_t last = ((guid257).gradient()).e2;
+                                                return (([&]() -> juniper::unit {
+                                                    (([&]() -> juniper::unit {
+                                                         Serial.println("Gradient"); 
+                                                        return {};
+                                                    })());
+                                                    (([&]() -> juniper::unit {
+                                                        if (((bool) (((line).get())->painted != just<NeoPixel::Function>(fn)))) {
+                                                            (([&]() -> juniper::unit {
+                                                                 Kernels::fillGradient(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, first, last); 
+                                                                return {};
+                                                            })());
+                                                        }
+                                                        return {};
+                                                    })());
+                                                    (((line).get())->offset = ((uint32_t) 0));
+                                                    return juniper::unit();
+                                                })());
+                                            })())
+                                        :
+                                            (((bool) (((bool) ((guid257).id() == ((uint8_t) 6))) && true)) ? 
+                                                (([&]() -> juniper::unit {
+                                                    uint8_t saturation = ((guid257).rainbow()).e1;
+                                                    uint8_t value = ((guid257).rainbow()).e2;
+                                                    return (([&]() -> juniper::unit {
+                                                        (([&]() -> juniper::unit {
+                                                             Serial.println("Rainbow"); 
+                                                            return {};
+                                                        })());
+                                                        (([&]() -> juniper::unit {
+                                                            if (((bool) (((line).get())->painted != just<NeoPixel::Function>(fn)))) {
+                                                                (([&]() -> juniper::unit {
+                                                                     Kernels::fillRainbow(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, saturation, value); 
+                                                                    return {};
+                                                                })());
+                                                            }
+                                                            return {};
+                                                        })());
+                                                        (((line).get())->offset = ((uint32_t) 0));
+                                                        return juniper::unit();
+                                                    })());
+                                                })())
+                                            :
+                                                (((bool) (((bool) ((guid257).id() == ((uint8_t) 7))) && true)) ? 
+                                                    (([&]() -> juniper::unit {
+                                                        uint8_t slot = (guid257).stream();
+                                                        return (([&]() -> juniper::unit {
+                                                            (([&]() -> juniper::unit {
+                                                                 Serial.println("Stream"); 
+                                                                return {};
+                                                            })());
+                                                            return (([&]() -> juniper::unit {
+                                                                 Streams::read(slot, &line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, line.get()->offset, Matrix::find(line.get()->matrix, line.get()->length)); 
+                                                                return {};
+                                                            })());
+                                                        })());
+                                                    })())
+                                                :
+                                                    juniper::quit<juniper::unit>()))))))));
+                })());
+                (((line).get())->painted = (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                    NeoPixel::Function guid311 = fn;
+                    return (((bool) (((bool) ((guid311).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                            return ((line).get())->painted;
+                        })())
+                    :
+                        (((bool) (((bool) ((guid311).id() == ((uint8_t) 1))) && true)) ? 
+                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                return just<NeoPixel::Function>(fn);
+                            })())
+                        :
+                            (((bool) (((bool) ((guid311).id() == ((uint8_t) 2))) && true)) ? 
+                                (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                    return just<NeoPixel::Function>(fn);
+                                })())
+                            :
+                                (((bool) (((bool) ((guid311).id() == ((uint8_t) 5))) && true)) ? 
+                                    (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                        return just<NeoPixel::Function>(fn);
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid311).id() == ((uint8_t) 6))) && true)) ? 
+                                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                            return just<NeoPixel::Function>(fn);
+                                        })())
+                                    :
+                                        (true ? 
+                                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                                return nothing<NeoPixel::Function>();
+                                            })())
+                                        :
+                                            juniper::quit<Prelude::maybe<NeoPixel::Function>>()))))));
+                })()));
+                return (([&]() -> juniper::unit {
+                    NeoPixel::Function guid327 = fn;
+                    return (((bool) (((bool) ((guid327).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> juniper::unit {
+                            return (([&]() -> juniper::unit {
+                                 Frames::rotated((Frames::Cache*) line.get()->frames); 
+                                return {};
+                            })());
+                        })())
+                    :
+                        (true ? 
+                            (([&]() -> juniper::unit {
+                                return (([&]() -> juniper::unit {
+                                     Frames::invalidate((Frames::Cache*) line.get()->frames); 
+                                    return {};
+                                })());
+                            })())
+                        :
+                            juniper::quit<juniper::unit>()));
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5007, int c302>
+    juniper::unit stepFade(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5007, c302>, uint32_t>, juniper::records::recordt_0<juniper::array<t5007, c302>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, uint32_t target, uint32_t duration) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nPixels = c302;
+            return (([&]() -> juniper::unit {
+                uint32_t guid305 = Time::now();
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t now = guid305;
+                
+                juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> guid306 = (([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> {
+                    Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>> guid307 = ((line).get())->fade;
+                    return (((bool) (((bool) ((guid307).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> {
+                            juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> existing = (guid307).just();
+                            return (((bool) ((existing).target == target)) ? 
+                                existing
+                            :
+                                (([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>{
+                                    juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> guid308;
+                                    guid308.target = target;
+                                    guid308.finish = ((uint32_t) (now + duration));
+                                    guid308.last = now;
+                                    return guid308;
+                                })()));
+                        })())
+                    :
+                        (((bool) (((bool) ((guid307).id() == ((uint8_t) 1))) && true)) ? 
+                            (([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> {
+                                return (([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>{
+                                    juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> guid309;
+                                    guid309.target = target;
+                                    guid309.finish = ((uint32_t) (now + duration));
+                                    guid309.last = now;
+                                    return guid309;
+                                })());
+                            })())
+                        :
+                            juniper::quit<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>()));
+                })());
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> current = guid306;
+                
+                return (reached((current).finish, now) ? 
+                    (([&]() -> juniper::unit {
+                        (([&]() -> juniper::unit {
+                             Kernels::fillPattern(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, target, target); 
+                            return {};
+                        })());
+                        (((line).get())->fade = nothing<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>());
+                        return juniper::unit();
+                    })())
+                :
+                    (([&]() -> juniper::unit {
+                        uint32_t weight;
+                        
+                        (([&]() -> juniper::unit {
+                             uint32_t remaining = current.finish - current.last; weight = (uint32_t) ((((uint64_t) (now - current.last) << 8) + remaining / 2) / remaining); 
+                            return {};
+                        })());
+                        return (((bool) (weight > ((uint32_t) 0))) ? 
+                            (([&]() -> juniper::unit {
+                                (([&]() -> juniper::unit {
+                                     Kernels::blendTowards(&line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, target, weight); 
+                                    return {};
+                                })());
+                                (((line).get())->fade = just<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>((([&]() -> juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>{
+                                    juniper::records::recordt_13<uint32_t, uint32_t, uint32_t> guid310;
+                                    guid310.target = target;
+                                    guid310.finish = (current).finish;
+                                    guid310.last = now;
+                                    return guid310;
+                                })())));
+                                return juniper::unit();
+                            })())
+                        :
+                            (([&]() -> juniper::unit {
+                                (((line).get())->fade = just<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>(current));
+                                return juniper::unit();
+                            })()));
+                    })()));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5008, int c265>
+    juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> diffPixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5008, c265>, uint32_t>, juniper::records::recordt_0<juniper::array<t5008, c265>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, uint32_t from) {
+        return (([&]() -> juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> {
+            constexpr int32_t nPixels = c265;
+            return (([&]() -> juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> {
+                juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130> spans;
+                
+                uint32_t guid322 = Math::min_<uint32_t>(diffWindow, ((uint32_t) (((line).get())->length - from)));
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t window = guid322;
+                
+                uint32_t guid261 = ((uint32_t) 0);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t count = guid261;
+                
+                (([&]() -> juniper::unit {
+                     count = Kernels::diffSpans(&line.get()->arena.get()->previousPixels.data[line.get()->start], &line.get()->arena.get()->pixels.data[line.get()->start], line.get()->length, line.get()->offset, from, window, &spans[0]); 
+                    return {};
+                })());
+                return (([&]() -> juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t>{
+                    juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> guid262;
+                    guid262.data = spans;
+                    guid262.length = count;
+                    return guid262;
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    juniper::unit setPixelColor(uint16_t n, uint32_t color, NeoPixel::RawDevice line) {
+        return (([&]() -> juniper::unit {
+            NeoPixel::RawDevice guid260 = line;
+            if (!(((bool) (((bool) ((guid260).id() == ((uint8_t) 0))) && true)))) {
+                juniper::quit<juniper::unit>();
+            }
+            void * p = (guid260).device();
+            
+            return (([&]() -> juniper::unit {
+                 ((Adafruit_NeoPixel*) p)->setPixelColor(n, color); 
+                return {};
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    juniper::unit show(NeoPixel::RawDevice line) {
+        return (([&]() -> juniper::unit {
+            NeoPixel::RawDevice guid262 = line;
+            if (!(((bool) (((bool) ((guid262).id() == ((uint8_t) 0))) && true)))) {
+                juniper::quit<juniper::unit>();
+            }
+            void * p = (guid262).device();
+            
+            (([&]() -> juniper::unit {
+                 ((Adafruit_NeoPixel*) p)->show(); 
+                return {};
+            })());
+            return (([&]() -> juniper::unit {
+                 Recorder::frame((Adafruit_NeoPixel*) p); 
+                return {};
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5009, int c268>
+    bool writePixels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5009, c268>, uint32_t>, juniper::records::recordt_0<juniper::array<t5009, c268>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> bool {
+            constexpr int32_t n = c268;
+            return (([&]() -> bool {
+            Prelude::maybe<NeoPixel::RawDevice> guid325 = ((line).get())->device;
+            return (((bool) (((bool) ((guid325).id() == ((uint8_t) 0))) && ((bool) (((bool) (((guid325).just()).id() == ((uint8_t) 0))) && true)))) ? 
+                (([&]() -> bool {
+                    void * p = ((guid325).just()).device();
+                    return (([&]() -> bool {
+                        int32_t replayed;
+                        
+                        (([&]() -> juniper::unit {
+                             replayed = Frames::replay((Frames::Cache*) line.get()->frames, (Adafruit_NeoPixel*) p, &line.get()->arena.get()->pixels.data[line.get()->start], &line.get()->arena.get()->previousPixels.data[line.get()->start], line.get()->length, line.get()->offset); 
+                            return {};
+                        })());
+                        return (((bool) (replayed < ((int32_t) 0))) ? 
+                            (([&]() -> bool {
+                                bool guid326 = writeSpans<t5009, c268>(line);
+                                if (!(true)) {
+                                    juniper::quit<juniper::unit>();
+                                }
+                                bool changed = guid326;
+                                
+                                (([&]() -> juniper::unit {
+                                     Frames::record((Frames::Cache*) line.get()->frames, (Adafruit_NeoPixel*) p, line.get()->length, line.get()->offset); 
+                                    return {};
+                                })());
+                                return changed;
+                            })())
+                        :
+                            (([&]() -> bool {
+                                return ((bool) (replayed > ((int32_t) 0)));
+                            })()));
+                    })());
+                })())
+            :
+                (((bool) (((bool) ((guid325).id() == ((uint8_t) 1))) && true)) ? 
+                    (([&]() -> bool {
+                        return writeSpans<t5009, c268>(line);
+                    })())
+                :
+                    juniper::quit<bool>()));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5021, int c306>
+    bool writeSpans(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5021, c306>, uint32_t>, juniper::records::recordt_0<juniper::array<t5021, c306>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> bool {
+            constexpr int32_t n = c306;
+            return (([&]() -> bool {
+                uint32_t guid263 = ((uint32_t) (((line).get())->length - ((line).get())->offset));
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t split = guid263;
+                
+                bool guid323 = false;
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                bool changed = guid323;
+                
+                uint32_t guid324 = ((uint32_t) 0);
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                uint32_t from = guid324;
+                
+                (([&]() -> juniper::unit {
+                    while (((bool) (from < ((line).get())->length))) {
+                        (([&]() -> juniper::unit {
+                        juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> guid264 = diffPixels<t5021, c306>(line, from);
+                        if (!(true)) {
+                            juniper::quit<juniper::unit>();
+                        }
+                        juniper::records::recordt_0<juniper::array<juniper::records::recordt_11<uint16_t, uint16_t>, 130>, uint32_t> spans = guid264;
+                
+                        (([&]() -> juniper::unit {
+                            uint32_t guid265 = ((uint32_t) 0);
+                            uint32_t guid266 = (spans).length;
+                            for (uint32_t s = guid265; s < guid266; s++) {
+                                (([&]() -> juniper::unit {
+                                    juniper::records::recordt_11<uint16_t, uint16_t> guid267 = ((spans).data)[s];
+                                    if (!(true)) {
+                                        juniper::quit<juniper::unit>();
+                                    }
+                                    juniper::records::recordt_11<uint16_t, uint16_t> span = guid267;
+                            
+                                    uint32_t guid268 = cast<uint16_t, uint32_t>((span).start);
+                                    if (!(true)) {
+                                        juniper::quit<juniper::unit>();
+                                    }
+                                    uint32_t start = guid268;
+                            
+                                    uint32_t guid269 = cast<uint16_t, uint32_t>((span).length);
+                                    if (!(true)) {
+                                        juniper::quit<juniper::unit>();
+                                    }
+                                    uint32_t length = guid269;
+                            
+                                    uint32_t guid270 = (((bool) (start < split)) ? 
+                                        ((uint32_t) (((uint32_t) (((line).get())->start + start)) + ((line).get())->offset))
+                                    :
+                                        ((uint32_t) (((uint32_t) (((line).get())->start + start)) - split)));
+                                    if (!(true)) {
+                                        juniper::quit<juniper::unit>();
+                                    }
+                                    uint32_t source = guid270;
+                            
+                                    uint32_t guid320 = ((uint32_t) (((line).get())->start + start));
+                                    if (!(true)) {
+                                        juniper::quit<juniper::unit>();
+                                    }
+                                    uint32_t target = guid320;
+                            
+                                    (([&]() -> juniper::unit {
+                                         Kernels::copyPixels(&line.get()->arena.get()->previousPixels.data[target], &line.get()->arena.get()->pixels.data[source], length); 
+                                        return {};
+                                    })());
                                     return (([&]() -> juniper::unit {
-                                        Prelude::maybe<NeoPixel::RawDevice> guid265 = ((line).get())->device;
-                                        return (((bool) (((bool) ((guid265).id() == ((uint8_t) 0))) && true)) ? 
+                                        Prelude::maybe<NeoPixel::RawDevice> guid271 = ((line).get())->device;
+                                        return (((bool) (((bool) ((guid271).id() == ((uint8_t) 0))) && ((bool) (((bool) (((guid271).just()).id() == ((uint8_t) 0))) && true)))) ? 
                                             (([&]() -> juniper::unit {
-                                                NeoPixel::RawDevice device = (guid265).just();
-                                                return setPixelColor(cast<uint32_t, uint16_t>(index), pixel, device);
+                                                void * p = ((guid271).just()).device();
+                                                return (([&]() -> juniper::unit {
+                                                     Kernels::writeGRB((Adafruit_NeoPixel*) p, start, &line.get()->arena.get()->pixels.data[source], length, &line.get()->levels.data[0], Palette::colors()); 
+                                                    return {};
+                                                })());
                                             })())
                                         :
-                                            (((bool) (((bool) ((guid265).id() == ((uint8_t) 1))) && true)) ? 
+                                            (((bool) (((bool) ((guid271).id() == ((uint8_t) 1))) && true)) ? 
                                                 (([&]() -> juniper::unit {
                                                     return (([&]() -> juniper::unit {
                                                          Serial.println("setPixelColor"); 
@@ -9049,49 +10430,478 @@ namespace NeoPixel {
                                             :
                                                 juniper::quit<juniper::unit>()));
                                     })());
+                                })());
+                            }
+                            return {};
+                        })());
+                            (changed = ((bool) (changed || ((bool) ((spans).length > ((uint32_t) 0))))));
+                            (from += diffWindow);
+                            return juniper::unit();
+                        })());
+                    }
+                    return {};
+                })());
+                return changed;
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t> makeLevels(uint8_t brightness, bool gammaCorrect) {
+        return (([&]() -> juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t> {
+            juniper::array<uint8_t, 256> levels;
+            
+            (([&]() -> juniper::unit {
+                 Kernels::fillLevels(&levels[0], brightness, gammaCorrect); 
+                return {};
+            })());
+            return (([&]() -> juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>{
+                juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t> guid275;
+                guid275.data = levels;
+                guid275.length = ((uint32_t) 256);
+                return guid275;
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5010, int c280>
+    juniper::unit refreshLevels(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5010, c280>, uint32_t>, juniper::records::recordt_0<juniper::array<t5010, c280>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c280;
+            return (([&]() -> juniper::unit {
+                (((line).get())->levels = makeLevels(((line).get())->brightness, ((line).get())->gammaCorrect));
+                return resendLine<t5010, c280>(line);
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5019, int c303>
+    juniper::unit resendLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5019, c303>, uint32_t>, juniper::records::recordt_0<juniper::array<t5019, c303>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c303;
+            return (([&]() -> juniper::unit {
+                (([&]() -> juniper::unit {
+                Prelude::maybe<NeoPixel::RawDevice> guid276 = ((line).get())->device;
+                return (((bool) (((bool) ((guid276).id() == ((uint8_t) 0))) && ((bool) (((bool) (((guid276).just()).id() == ((uint8_t) 0))) && true)))) ? 
+                    (([&]() -> juniper::unit {
+                        void * p = ((guid276).just()).device();
+                        return (([&]() -> juniper::unit {
+                            (([&]() -> juniper::unit {
+                                 Frames::invalidate((Frames::Cache*) line.get()->frames); 
+                                return {};
+                            })());
+                            return (([&]() -> juniper::unit {
+                                 Kernels::writeGRB((Adafruit_NeoPixel*) p, 0, &line.get()->arena.get()->previousPixels.data[line.get()->start], line.get()->length, &line.get()->levels.data[0], Palette::colors()); 
+                                return {};
+                            })());
+                        })());
+                    })())
+                :
+                    (((bool) (((bool) ((guid276).id() == ((uint8_t) 1))) && true)) ? 
+                        (([&]() -> juniper::unit {
+                            return juniper::unit();
+                        })())
+                    :
+                        juniper::quit<juniper::unit>()));
+                })());
+                (((line).get())->unsent = true);
+                (((line).get())->clean = false);
+                return juniper::unit();
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5025, int c310>
+    juniper::unit showResent(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5025, c310>, uint32_t>, juniper::records::recordt_0<juniper::array<t5025, c310>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c310;
+            return (([&]() -> juniper::unit {
+                if (((line).get())->unsent) {
+                    (([&]() -> juniper::unit {
+                        return showLine<t5025, c310>(line, commitLine<t5025, c310>(line));
+                    })());
+                }
+                return {};
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5020, int c304, int c305>
+    juniper::unit refreshPalette(juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>, juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c304>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c304>, uint32_t>>> model) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t nLines = c304;
+            constexpr int32_t nPixels = c305;
+            return (([&]() -> juniper::unit {
+                bool indexed;
+                
+                (([&]() -> juniper::unit {
+                     indexed = sizeof(model.get()->lines.data[0].get()->arena.get()->pixels.data[0]) == 1; 
+                    return {};
+                })());
+                return (([&]() -> juniper::unit {
+                    if (indexed) {
+                        (([&]() -> juniper::unit {
+                            return List::iter<void, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>, juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c304>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>, juniper::records::recordt_0<juniper::array<t5020, c305>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>)>(resendLine<t5020, c305>), ((model).get())->lines);
+                        })());
+                    }
+                    return {};
+                })());
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    Prelude::maybe<NeoPixel::Function> foldFunctions(NeoPixel::Function first, NeoPixel::Function second) {
+        return (([&]() -> Prelude::maybe<NeoPixel::Function> {
+            NeoPixel::Function guid299 = second;
+            return (((bool) (((bool) ((guid299).id() == ((uint8_t) 0))) && true)) ? 
+                (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                    int16_t step = (guid299).rotate();
+                    return (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                        NeoPixel::Function guid300 = first;
+                        return (((bool) (((bool) ((guid300).id() == ((uint8_t) 0))) && true)) ? 
+                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                int16_t previous = (guid300).rotate();
+                                return (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                int32_t guid301 = ((int32_t) (cast<int16_t, int32_t>(previous) + cast<int16_t, int32_t>(step)));
+                                if (!(true)) {
+                                    juniper::quit<juniper::unit>();
+                                }
+                                int32_t total = guid301;
+                                
+                                    return (((bool) (((bool) (total >= ((int32_t) -32768))) && ((bool) (total <= ((int32_t) 32767))))) ? 
+                                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                            return just<NeoPixel::Function>(rotate(cast<int32_t, int16_t>(total)));
+                                        })())
+                                    :
+                                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                            return nothing<NeoPixel::Function>();
+                                        })()));
+                                })());
+                            })())
+                        :
+                            (true ? 
+                                (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                    return nothing<NeoPixel::Function>();
                                 })())
                             :
-                                (((bool) (((bool) ((guid264).id() == ((uint8_t) 1))) && true)) ? 
-                                    (([&]() -> juniper::unit {
-                                        return juniper::unit();
+                                juniper::quit<Prelude::maybe<NeoPixel::Function>>()));
+                    })());
+                })())
+            :
+                (((bool) (((bool) ((guid299).id() == ((uint8_t) 1))) && true)) ? 
+                    (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                        return just<NeoPixel::Function>(second);
+                    })())
+                :
+                    (((bool) (((bool) ((guid299).id() == ((uint8_t) 2))) && true)) ? 
+                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                            return just<NeoPixel::Function>(second);
+                        })())
+                    :
+                        (((bool) (((bool) ((guid299).id() == ((uint8_t) 3))) && true)) ? 
+                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                return nothing<NeoPixel::Function>();
+                            })())
+                        :
+                            (((bool) (((bool) ((guid299).id() == ((uint8_t) 4))) && true)) ? 
+                                (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                    return nothing<NeoPixel::Function>();
+                                })())
+                            :
+                                (((bool) (((bool) ((guid299).id() == ((uint8_t) 5))) && true)) ? 
+                                    (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                        return just<NeoPixel::Function>(second);
                                     })())
                                 :
-                                    juniper::quit<juniper::unit>()));
+                                    (((bool) (((bool) ((guid299).id() == ((uint8_t) 6))) && true)) ? 
+                                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                            return just<NeoPixel::Function>(second);
+                                        })())
+                                    :
+                                        (((bool) (((bool) ((guid299).id() == ((uint8_t) 7))) && true)) ? 
+                                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                                return nothing<NeoPixel::Function>();
+                                            })())
+                                        :
+                                            juniper::quit<Prelude::maybe<NeoPixel::Function>>()))))))));
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5011, int c300>
+    juniper::unit stageFunction(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5011, c300>, uint32_t>, juniper::records::recordt_0<juniper::array<t5011, c300>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c300;
+            return (([&]() -> juniper::unit {
+                (((line).get())->pending = (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                    Prelude::maybe<NeoPixel::Function> guid302 = ((line).get())->pending;
+                    return (((bool) (((bool) ((guid302).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                            NeoPixel::Function waiting = (guid302).just();
+                            return (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                Prelude::maybe<NeoPixel::Function> guid303 = foldFunctions(waiting, fn);
+                                return (((bool) (((bool) ((guid303).id() == ((uint8_t) 0))) && true)) ? 
+                                    (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                        NeoPixel::Function folded = (guid303).just();
+                                        return just<NeoPixel::Function>(folded);
+                                    })())
+                                :
+                                    (((bool) (((bool) ((guid303).id() == ((uint8_t) 1))) && true)) ? 
+                                        (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                            return (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                                applyFunction<t5011, c300>(waiting, line);
+                                                return just<NeoPixel::Function>(fn);
+                                            })());
+                                        })())
+                                    :
+                                        juniper::quit<Prelude::maybe<NeoPixel::Function>>()));
+                            })());
+                        })())
+                    :
+                        (((bool) (((bool) ((guid302).id() == ((uint8_t) 1))) && true)) ? 
+                            (([&]() -> Prelude::maybe<NeoPixel::Function> {
+                                return just<NeoPixel::Function>(fn);
+                            })())
+                        :
+                            juniper::quit<Prelude::maybe<NeoPixel::Function>>()));
+                })()));
+                return juniper::unit();
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5024, int c309>
+    juniper::unit flushLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5024, c309>, uint32_t>, juniper::records::recordt_0<juniper::array<t5024, c309>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c309;
+            return (([&]() -> juniper::unit {
+                Prelude::maybe<NeoPixel::Function> guid335 = ((line).get())->pending;
+                return (((bool) (((bool) ((guid335).id() == ((uint8_t) 0))) && true)) ? 
+                    (([&]() -> juniper::unit {
+                        NeoPixel::Function fn = (guid335).just();
+                        return (([&]() -> juniper::unit {
+                            (((line).get())->pending = nothing<NeoPixel::Function>());
+                            return applyFunction<t5024, c309>(fn, line);
                         })());
-                    })());
-                 }), ListExt::enumerated<Prelude::maybe<NeoPixel::color>, c268>(diffPixels<c268>(((line).get())->previousPixels, ((line).get())->pixels)));
-                return (([&]() -> juniper::unit {
-                    Prelude::maybe<NeoPixel::RawDevice> guid266 = ((line).get())->device;
-                    return (((bool) (((bool) ((guid266).id() == ((uint8_t) 0))) && true)) ? 
+                    })())
+                :
+                    (((bool) (((bool) ((guid335).id() == ((uint8_t) 1))) && true)) ? 
                         (([&]() -> juniper::unit {
-                            NeoPixel::RawDevice device = (guid266).just();
-                            return show(device);
+                            return juniper::unit();
                         })())
                     :
-                        (((bool) (((bool) ((guid266).id() == ((uint8_t) 1))) && true)) ? 
-                            (([&]() -> juniper::unit {
-                                return (([&]() -> juniper::unit {
-                                     Serial.println("show"); 
-                                    return {};
-                                })());
+                        juniper::quit<juniper::unit>()));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5012, int c272>
+    juniper::unit updateLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5012, c272>, uint32_t>, juniper::records::recordt_0<juniper::array<t5012, c272>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c272;
+            return showLine<t5012, c272>(line, renderLine<t5012, c272>(line, fn));
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5013, int c281>
+    bool renderLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5013, c281>, uint32_t>, juniper::records::recordt_0<juniper::array<t5013, c281>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, NeoPixel::Function fn) {
+        return (([&]() -> bool {
+            constexpr int32_t n = c281;
+            return (([&]() -> bool {
+                applyFunction<t5013, c281>(fn, line);
+                return (((line).get())->clean ? 
+                    (([&]() -> bool {
+                        return false;
+                    })())
+                :
+                    (([&]() -> bool {
+                        return commitLine<t5013, c281>(line);
+                    })()));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5014, int c286>
+    bool commitLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5014, c286>, uint32_t>, juniper::records::recordt_0<juniper::array<t5014, c286>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> bool {
+            constexpr int32_t n = c286;
+            return (([&]() -> bool {
+                bool guid282 = (([&]() -> bool {
+                    Prelude::maybe<NeoPixel::RawDevice> guid283 = ((line).get())->device;
+                    return (((bool) (((bool) ((guid283).id() == ((uint8_t) 0))) && true)) ? 
+                        (([&]() -> bool {
+                            NeoPixel::RawDevice device = (guid283).just();
+                            return canShow(device);
+                        })())
+                    :
+                        (((bool) (((bool) ((guid283).id() == ((uint8_t) 1))) && true)) ? 
+                            (([&]() -> bool {
+                                return true;
                             })())
                         :
-                            juniper::quit<juniper::unit>()));
+                            juniper::quit<bool>()));
                 })());
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                bool ready = guid282;
+                
+                return (ready ? 
+                    (([&]() -> bool {
+                        (((line).get())->deferred = false);
+                        bool guid328 = ((bool) (writePixels<t5014, c286>(line) || ((line).get())->unsent));
+                        if (!(true)) {
+                            juniper::quit<juniper::unit>();
+                        }
+                        bool changed = guid328;
+                        
+                        (((line).get())->unsent = false);
+                        (((line).get())->clean = true);
+                        return changed;
+                    })())
+                :
+                    (([&]() -> bool {
+                        (((line).get())->deferred = true);
+                        return false;
+                    })()));
             })());
         })());
     }
 }
 
 namespace NeoPixel {
-    template<int c272>
-    juniper::unit updateLine(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c272>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c272>, uint32_t>>> line, NeoPixel::Function fn) {
+    template<typename t5015, int c282>
+    juniper::unit showLine(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5015, c282>, uint32_t>, juniper::records::recordt_0<juniper::array<t5015, c282>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line, bool changed) {
         return (([&]() -> juniper::unit {
-            constexpr int32_t n = c272;
+            constexpr int32_t n = c282;
+            return (changed ? 
+                (([&]() -> juniper::unit {
+                        return (([&]() -> juniper::unit {
+                            Prelude::maybe<NeoPixel::RawDevice> guid277 = ((line).get())->device;
+                            return (((bool) (((bool) ((guid277).id() == ((uint8_t) 0))) && true)) ? 
+                                (([&]() -> juniper::unit {
+                                    NeoPixel::RawDevice device = (guid277).just();
+                                    return show(device);
+                                })())
+                            :
+                                (((bool) (((bool) ((guid277).id() == ((uint8_t) 1))) && true)) ? 
+                                    (([&]() -> juniper::unit {
+                                        return (([&]() -> juniper::unit {
+                                             Serial.println("show"); 
+                                            return {};
+                                        })());
+                                    })())
+                                :
+                                    juniper::quit<juniper::unit>()));
+                        })());
+                })())
+            :
+                (((line).get())->deferred ? 
+                    (([&]() -> juniper::unit {
+                        return juniper::unit();
+                    })())
+                :
+                    (([&]() -> juniper::unit {
+                        (suppressedShows = ((uint32_t) (suppressedShows + ((uint32_t) 1))));
+                        return juniper::unit();
+                    })())));
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5016, int c283>
+    Prelude::maybe<bool> renderPending(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5016, c283>, uint32_t>, juniper::records::recordt_0<juniper::array<t5016, c283>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) {
+        return (([&]() -> Prelude::maybe<bool> {
+            constexpr int32_t n = c283;
+            return (([&]() -> Prelude::maybe<bool> {
+                Prelude::maybe<NeoPixel::Function> guid278 = ((line).get())->pending;
+                return (((bool) (((bool) ((guid278).id() == ((uint8_t) 0))) && true)) ? 
+                    (([&]() -> Prelude::maybe<bool> {
+                        NeoPixel::Function fn = (guid278).just();
+                        return (([&]() -> Prelude::maybe<bool> {
+                            (((line).get())->pending = nothing<NeoPixel::Function>());
+                            return just<bool>(renderLine<t5016, c283>(line, fn));
+                        })());
+                    })())
+                :
+                    (((bool) (((bool) ((guid278).id() == ((uint8_t) 1))) && true)) ? 
+                        (([&]() -> Prelude::maybe<bool> {
+                            return (!(((line).get())->clean) ? 
+                                just<bool>(commitLine<t5016, c283>(line))
+                            :
+                                nothing<bool>());
+                        })())
+                    :
+                        juniper::quit<Prelude::maybe<bool>>()));
+            })());
+        })());
+    }
+}
+
+namespace NeoPixel {
+    template<typename t5017, int c284, int c285>
+    juniper::unit renderLines(juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t> lines) {
+        return (([&]() -> juniper::unit {
+            constexpr int32_t n = c284;
+            constexpr int32_t nLines = c285;
             return (([&]() -> juniper::unit {
-                (((line).get())->previousPixels = ((line).get())->pixels);
-                (((line).get())->pixels = applyFunction<c272>(fn, ((line).get())->previousPixels));
-                return writePixels<c272>(line);
+                juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, Prelude::maybe<bool>(uint32_t)> guid279 = juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, Prelude::maybe<bool>(uint32_t)>(juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>(lines), [](juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>& junclosure, uint32_t i) -> Prelude::maybe<bool> { 
+                    juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>& lines = junclosure.lines;
+                    return renderPending<t5017, c284>(((lines).data)[i]);
+                 });
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, Prelude::maybe<bool>(uint32_t)> render = guid279;
+                
+                juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, juniper::unit(uint32_t, Prelude::maybe<bool>)> guid280 = juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, juniper::unit(uint32_t, Prelude::maybe<bool>)>(juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>(lines), [](juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>& junclosure, uint32_t i, Prelude::maybe<bool> rendered) -> juniper::unit { 
+                    juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>& lines = junclosure.lines;
+                    return (([&]() -> juniper::unit {
+                        Prelude::maybe<bool> guid281 = rendered;
+                        return (((bool) (((bool) ((guid281).id() == ((uint8_t) 0))) && true)) ? 
+                            (([&]() -> juniper::unit {
+                                bool changed = (guid281).just();
+                                return showLine<t5017, c284>(((lines).data)[i], changed);
+                            })())
+                        :
+                            (((bool) (((bool) ((guid281).id() == ((uint8_t) 1))) && true)) ? 
+                                (([&]() -> juniper::unit {
+                                    return juniper::unit();
+                                })())
+                            :
+                                juniper::quit<juniper::unit>()));
+                    })());
+                 });
+                if (!(true)) {
+                    juniper::quit<juniper::unit>();
+                }
+                juniper::function<juniper::closures::closuret_11<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>, juniper::records::recordt_0<juniper::array<t5017, c284>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c285>, uint32_t>>, juniper::unit(uint32_t, Prelude::maybe<bool>)> output = guid280;
+                
+                return (([&]() -> juniper::unit {
+                     Workers::forEach<nLines>(render, output); 
+                    return {};
+                })());
             })());
         })());
     }
@@ -9115,8 +10925,8 @@ namespace NeoPixel {
 }
 
 namespace NeoPixel {
-    template<int c275, int c276>
-    juniper::unit update(Prelude::maybe<NeoPixel::Action> act, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>> model) {
+    template<typename t5018, int c275, int c276>
+    juniper::unit update(Prelude::maybe<NeoPixel::Action> act, juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>> model) {
         return (([&]() -> juniper::unit {
             constexpr int32_t nLines = c275;
             constexpr int32_t nPixels = c276;
@@ -9125,8 +10935,12 @@ namespace NeoPixel {
                      Serial.println("update"); 
                     return {};
                 })());
-                return Signal::sink<NeoPixel::Update, juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>>>>(juniper::function<juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>>>, juniper::unit(NeoPixel::Update)>(juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>>>(model), [](juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>>>& junclosure, NeoPixel::Update update) -> juniper::unit { 
-                    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>, uint32_t>>>& model = junclosure.model;
+                (([&]() -> juniper::unit {
+                     Recorder::update(act); 
+                    return {};
+                })());
+                return Signal::sink<NeoPixel::Update, juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>>>>(juniper::function<juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>>>, juniper::unit(NeoPixel::Update)>(juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>>>(model), [](juniper::closures::closuret_10<juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>>>& junclosure, NeoPixel::Update update) -> juniper::unit { 
+                    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, c275>, uint32_t>>>& model = junclosure.model;
                     return (([&]() -> juniper::unit {
                         return (([&]() -> juniper::unit {
                             NeoPixel::Update guid268 = update;
@@ -9147,7 +10961,7 @@ namespace NeoPixel {
                                                              Serial.println("start"); 
                                                             return {};
                                                         })());
-                                                        return List::iter<void, juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>)>([](juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>> line) -> juniper::unit { 
+                                                        List::iter<void, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>)>([](juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>> line) -> juniper::unit { 
                                                             return (([&]() -> juniper::unit {
                                                                 return (([&]() -> juniper::unit {
                                                                     Prelude::maybe<NeoPixel::RawDevice> guid270 = ((line).get())->device;
@@ -9169,6 +10983,8 @@ namespace NeoPixel {
                                                                 })());
                                                             })());
                                                          }), ((model).get())->lines);
+                                                        refreshPalette<t5018, c275, c276>(model);
+                                                        return List::iter<void, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>)>(showResent<t5018, c276>), ((model).get())->lines);
                                                     })());
                                                 })())
                                             :
@@ -9181,7 +10997,7 @@ namespace NeoPixel {
                                                                  Serial.println("run"); 
                                                                 return {};
                                                             })());
-                                                            return updateLine<c276>(((((model).get())->lines).data)[line], fn);
+                                                            return updateLine<t5018, c276>(((((model).get())->lines).data)[line], fn);
                                                         })());
                                                     })())
                                                 :
@@ -9196,16 +11012,8 @@ namespace NeoPixel {
                                                                      Serial.println("repeat"); 
                                                                     return {};
                                                                 })());
-                                                                updateLine<c276>(((((model).get())->lines).data)[line], fn);
-                                                                (((((((model).get())->lines).data)[line]).get())->operation = just<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>((([&]() -> juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>{
-                                                                    juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>> guid271;
-                                                                    guid271.function = fn;
-                                                                    guid271.interval = interval;
-                                                                    guid271.timer = Time::state;
-                                                                    guid271.endAfter = endAfter;
-                                                                    return guid271;
-                                                                })())));
-                                                                return juniper::unit();
+                                                                updateLine<t5018, c276>(((((model).get())->lines).data)[line], fn);
+                                                                return startOperation<t5018, c275, c276>(model, line, fn, interval, endAfter, Time::now());
                                                             })());
                                                         })())
                                                     :
@@ -9217,12 +11025,91 @@ namespace NeoPixel {
                                                                          Serial.println("endRepeat"); 
                                                                         return {};
                                                                     })());
-                                                                    (((((((model).get())->lines).data)[line]).get())->operation = nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>());
-                                                                    return juniper::unit();
+                                                                    (((((((model).get())->lines).data)[line]).get())->operation = nothing<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>());
+                                                                    return unscheduleLine<c275>(((model).get())->schedule, line);
                                                                 })());
                                                             })())
                                                         :
-                                                            juniper::quit<juniper::unit>()))));
+                                                            (((bool) (((bool) ((guid269).id() == ((uint8_t) 4))) && true)) ? 
+                                                                (([&]() -> juniper::unit {
+                                                                    uint8_t level = ((guid269).brightness()).e2;
+                                                                    uint8_t line = ((guid269).brightness()).e1;
+                                                                    return (([&]() -> juniper::unit {
+                                                                        (([&]() -> juniper::unit {
+                                                                             Serial.println("brightness"); 
+                                                                            return {};
+                                                                        })());
+                                                                        (((((((model).get())->lines).data)[line]).get())->brightness = level);
+                                                                        refreshLevels<t5018, c276>(((((model).get())->lines).data)[line]);
+                                                                        return showResent<t5018, c276>(((((model).get())->lines).data)[line]);
+                                                                    })());
+                                                                })())
+                                                            :
+                                                                (((bool) (((bool) ((guid269).id() == ((uint8_t) 5))) && true)) ? 
+                                                                    (([&]() -> juniper::unit {
+                                                                        bool enabled = ((guid269).gammaCorrect()).e2;
+                                                                        uint8_t line = ((guid269).gammaCorrect()).e1;
+                                                                        return (([&]() -> juniper::unit {
+                                                                            (([&]() -> juniper::unit {
+                                                                                 Serial.println("gammaCorrect"); 
+                                                                                return {};
+                                                                            })());
+                                                                            (((((((model).get())->lines).data)[line]).get())->gammaCorrect = enabled);
+                                                                            refreshLevels<t5018, c276>(((((model).get())->lines).data)[line]);
+                                                                            return showResent<t5018, c276>(((((model).get())->lines).data)[line]);
+                                                                        })());
+                                                                    })())
+                                                                :
+                                                                    (((bool) (((bool) ((guid269).id() == ((uint8_t) 6))) && true)) ? 
+                                                                        (([&]() -> juniper::unit {
+                                                                            uint32_t c = ((guid269).paletteColor()).e2;
+                                                                            uint8_t index = ((guid269).paletteColor()).e1;
+                                                                            return (([&]() -> juniper::unit {
+                                                                                (([&]() -> juniper::unit {
+                                                                                     Serial.println("paletteColor"); 
+                                                                                    return {};
+                                                                                })());
+                                                                                (([&]() -> juniper::unit {
+                                                                                     Palette::set(index, c); 
+                                                                                    return {};
+                                                                                })());
+                                                                                refreshPalette<t5018, c275, c276>(model);
+                                                                                return List::iter<void, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>)>(showResent<t5018, c276>), ((model).get())->lines);
+                                                                            })());
+                                                                        })())
+                                                                    :
+                                                                        (((bool) (((bool) ((guid269).id() == ((uint8_t) 7))) && true)) ? 
+                                                                            (([&]() -> juniper::unit {
+                                                                                int16_t step = (guid269).rotatePalette();
+                                                                                return (([&]() -> juniper::unit {
+                                                                                    (([&]() -> juniper::unit {
+                                                                                         Serial.println("rotatePalette"); 
+                                                                                        return {};
+                                                                                    })());
+                                                                                    (([&]() -> juniper::unit {
+                                                                                         Palette::rotate(step); 
+                                                                                        return {};
+                                                                                    })());
+                                                                                    refreshPalette<t5018, c275, c276>(model);
+                                                                                    return List::iter<void, juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<t5018, c276>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>)>(showResent<t5018, c276>), ((model).get())->lines);
+                                                                                })());
+                                                                            })())
+                                                                        :
+                                                                            (((bool) (((bool) ((guid269).id() == ((uint8_t) 8))) && true)) ? 
+                                                                                (([&]() -> juniper::unit {
+                                                                                    uint8_t slot = ((guid269).matrix()).e2;
+                                                                                    uint8_t line = ((guid269).matrix()).e1;
+                                                                                    return (([&]() -> juniper::unit {
+                                                                                        (([&]() -> juniper::unit {
+                                                                                             Serial.println("matrix"); 
+                                                                                            return {};
+                                                                                        })());
+                                                                                        (((((((model).get())->lines).data)[line]).get())->matrix = slot);
+                                                                                        return juniper::unit();
+                                                                                    })());
+                                                                                })())
+                                                                            :
+                                                                                juniper::quit<juniper::unit>())))))))));
                                         })());
                                     })());
                                 })())
@@ -9234,17 +11121,8 @@ namespace NeoPixel {
                                                  Serial.println("operation"); 
                                                 return {};
                                             })());
-                                            return List::iter<void, juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>, c275>(juniper::function<void, juniper::unit(juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>)>([](juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>> line) -> juniper::unit { 
-                                                return (([&]() -> juniper::unit {
-                                                    (((line).get())->operation = runOperation<juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>>>(juniper::function<juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>>, juniper::unit(NeoPixel::Function)>(juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>>(line), [](juniper::closures::closuret_9<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>>& junclosure, NeoPixel::Function function) -> juniper::unit { 
-                                                        juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, c276>, uint32_t>>>& line = junclosure.line;
-                                                        return (([&]() -> juniper::unit {
-                                                            return updateLine<c276>(line, function);
-                                                        })());
-                                                     }), updateOperation(((line).get())->operation)));
-                                                    return juniper::unit();
-                                                })());
-                                             }), ((model).get())->lines);
+                                            runDue<t5018, c275, c276>(model);
+                                            return renderLines<t5018, c276, c275>(((model).get())->lines);
                                         })());
                                     })())
                                 :
@@ -9262,23 +11140,6 @@ namespace NeoPixel {
     }
 }
 
-namespace NeoPixel {
-    juniper::unit setBrightness(uint8_t level, NeoPixel::RawDevice line) {
-        return (([&]() -> juniper::unit {
-            NeoPixel::RawDevice guid273 = line;
-            if (!(((bool) (((bool) ((guid273).id() == ((uint8_t) 0))) && true)))) {
-                juniper::quit<juniper::unit>();
-            }
-            void * p = (guid273).device();
-            
-            return (([&]() -> juniper::unit {
-                 ((Adafruit_NeoPixel*) p)->setBrightness(level); 
-                return {};
-            })());
-        })());
-    }
-}
-
 namespace NeoPixel {
     uint8_t getBrightness(NeoPixel::RawDevice line) {
         return (([&]() -> uint8_t {
@@ -9345,16 +11206,14 @@ namespace NeoPixel {
 }
 
 namespace TEA {
-    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t, juniper::records::recordt_1<uint32_t>>>, uint16_t, juniper::records::recordt_0<juniper::array<NeoPixel::color, 150>, uint32_t>, juniper::records::recordt_0<juniper::array<NeoPixel::color, 150>, uint32_t>>>, 1>, uint32_t>>> state = initialState<150, 1>((juniper::array<juniper::records::recordt_7<uint16_t>, 1> { {(([]() -> juniper::records::recordt_7<uint16_t>{
-        juniper::records::recordt_7<uint16_t> guid279;
+    juniper::refcell<juniper::records::recordt_10<juniper::records::recordt_0<juniper::array<juniper::refcell<juniper::records::recordt_9<juniper::refcell<juniper::records::recordt_14<juniper::records::recordt_0<juniper::array<uint32_t, 150>, uint32_t>, juniper::records::recordt_0<juniper::array<uint32_t, 150>, uint32_t>>>, uint8_t, bool, bool, Prelude::maybe<NeoPixel::RawDevice>, Prelude::maybe<juniper::records::recordt_13<uint32_t, uint32_t, uint32_t>>, void *, bool, uint32_t, juniper::records::recordt_0<juniper::array<uint8_t, 256>, uint32_t>, uint8_t, uint32_t, Prelude::maybe<juniper::records::recordt_8<Prelude::maybe<uint8_t>, NeoPixel::Function, uint32_t>>, Prelude::maybe<NeoPixel::Function>, Prelude::maybe<NeoPixel::Function>, uint16_t, uint32_t, bool>>, 1>, uint32_t>, juniper::records::recordt_0<juniper::array<juniper::records::recordt_12<uint8_t, uint32_t>, 1>, uint32_t>>> state = initialState<uint32_t, 150, 1>((juniper::array<juniper::records::recordt_7<uint16_t, uint16_t>, 1> { {(([]() -> juniper::records::recordt_7<uint16_t, uint16_t>{
+        juniper::records::recordt_7<uint16_t, uint16_t> guid279;
         guid279.pin = ((uint16_t) 7);
+        guid279.length = ((uint16_t) 150);
         return guid279;
-    })())} }), ((uint16_t) 150));
+    })())} }));
 }
 
-namespace TEA {
-    Prelude::maybe<NeoPixel::Action> previousAction = just<NeoPixel::Action>(repeat(((uint8_t) 0), rotate(((int16_t) 1)), ((uint32_t) 3000), nothing<uint8_t>()));
-}
 
 namespace TEA {
     juniper::unit setup() {
@@ -9367,6 +11226,7 @@ namespace TEA {
                  while (!Serial) {} 
                 return {};
             })());
+            queueAction(repeat(((uint8_t) 0), rotate(((int16_t) 1)), ((uint32_t) 3000), nothing<uint8_t>()));
             (([&]() -> juniper::unit {
                  Serial.println("Setup complete"); 
                 return {};
@@ -9387,11 +11247,7 @@ namespace TEA {
                  Serial.println("_____"); 
                 return {};
             })());
-            return Signal::sink<Prelude::maybe<NeoPixel::Action>, void>(juniper::function<void, juniper::unit(Prelude::maybe<NeoPixel::Action>)>([](Prelude::maybe<NeoPixel::Action> action) -> juniper::unit { 
-                return (([&]() -> juniper::unit {
-                    return update<1, 150>(action, state);
-                })());
-             }), actions(previousAction));
+            return drainActions<uint32_t, 1, 150>(state);
         })());
     }
 }